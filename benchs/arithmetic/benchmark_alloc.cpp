@@ -0,0 +1,126 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_alloc.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+//============================================================================
+//
+// Counts the heap allocations performed by common operations on
+// vectors and matrices (returns by value, pairs, containers, jacobian).
+//
+// Usage: benchmark_alloc [n] [iterations]
+//
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+#include <new>
+#include <list>
+#include <vector>
+
+using namespace std;
+using namespace ibex;
+
+static unsigned long nb_alloc = 0;
+
+void* operator new(size_t size) {
+	nb_alloc++;
+	void* p=malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+	free(p);
+}
+
+void operator delete[](void* p) noexcept {
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+	free(p);
+}
+
+namespace {
+
+IntervalVector make_box(int n) {
+	IntervalVector x(n,Interval(-1,1));
+	return x;
+}
+
+pair<IntervalVector,double> make_loup(const Vector& pt) {
+	return make_pair(IntervalVector(pt), 0.0);
+}
+
+void report(const char* name, unsigned long before, int iter) {
+	cout << "  " << name << ": " << ((double) (nb_alloc-before))/iter << " alloc/op" << endl;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	int n    = argc>1 ? atoi(argv[1]) : 10;
+	int iter = argc>2 ? atoi(argv[2]) : 100000;
+
+	cout << "n=" << n << " iterations=" << iter << endl;
+
+	unsigned long before;
+
+	before=nb_alloc;
+	for (int k=0; k<iter; k++) {
+		IntervalVector x=make_box(n);
+	}
+	report("IntervalVector return     ", before, iter);
+
+	IntervalVector a(n,Interval(0,1));
+	IntervalVector b(n,Interval(1,2));
+	before=nb_alloc;
+	for (int k=0; k<iter; k++) {
+		IntervalVector c=a+b+a;
+	}
+	report("IntervalVector a+b+a      ", before, iter);
+
+	Vector pt(n,0.5);
+	before=nb_alloc;
+	for (int k=0; k<iter; k++) {
+		pair<IntervalVector,double> p=make_loup(pt);
+	}
+	report("pair<IntervalVector,double>", before, iter);
+
+	before=nb_alloc;
+	{
+		vector<IntervalVector> v;
+		for (int k=0; k<iter; k++)
+			v.push_back(make_box(n));
+	}
+	report("vector<IntervalVector>     ", before, iter);
+
+	IntervalMatrix M(n,n,Interval(0,1));
+	before=nb_alloc;
+	for (int k=0; k<iter/10; k++) {
+		IntervalMatrix P=M*M;
+	}
+	report("IntervalMatrix product     ", before, iter/10);
+
+	Variable x(n);
+	Function f(x,x);
+	IntervalVector box(n,Interval(-1,1));
+	before=nb_alloc;
+	for (int k=0; k<iter/10; k++) {
+		IntervalMatrix J=f.jacobian(box);
+	}
+	report("Function::jacobian         ", before, iter/10);
+
+	return 0;
+}
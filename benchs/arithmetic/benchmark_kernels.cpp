@@ -0,0 +1,287 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_kernels.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+//============================================================================
+//
+// Microbenchmarks of the innermost kernels: interval arithmetic (through
+// the interval library wrapper selected at configuration time), vector and
+// matrix operations, forward/backward evaluation (HC4Revise) and
+// Gauss-Seidel.
+//
+// Each benchmark is run with an increasing number of iterations until it
+// lasts at least --min-time seconds, and the time per operation (ns/op) is
+// reported. The interval library is fixed at configuration time
+// (-DINTERVAL_LIB=gaol|filib|direct|bias): to compare libraries, run the
+// program in one build per library; the first column of the CSV output
+// gives the library so that the outputs can be concatenated.
+//
+// Usage: benchmark_kernels [--filter=<substring>] [--min-time=<s>] [--csv]
+//
+//============================================================================
+
+#include "ibex.h"
+#include "parse_args.h"
+
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+/*
+ * Prevent the compiler from optimizing away a result.
+ */
+template<class T>
+inline void keep(const T& x) {
+#ifdef __GNUC__
+	asm volatile("" : : "g"(&x) : "memory");
+#else
+	static volatile const void* sink;
+	sink=&x;
+#endif
+}
+
+/*
+ * A benchmark runs "iterations" times an operation, each operation
+ * performing "ops" elementary operations (e.g., 1024 interval additions).
+ */
+struct Bench {
+	virtual ~Bench() { }
+	virtual void run(long iterations)=0;
+	string name;
+	long ops;
+};
+
+template<class F>
+struct BenchF : Bench {
+	BenchF(const string& name, long ops, F f) : f(f) {
+		this->name=name;
+		this->ops=ops;
+	}
+	void run(long iterations) {
+		for (long i=0; i<iterations; i++) f();
+	}
+	F f;
+};
+
+vector<Bench*> benchs;
+
+vector<Function*> functions;
+
+template<class F>
+void add(const string& name, long ops, F f) {
+	benchs.push_back(new BenchF<F>(name,ops,f));
+}
+
+double now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * Random interval of width at most w inside [lo,hi].
+ */
+Interval random_interval(double lo, double hi, double w) {
+	double a=RNG::rand(lo,hi);
+	return Interval(a,a+RNG::rand(0,w));
+}
+
+IntervalVector random_vector(int n, double lo, double hi, double w) {
+	IntervalVector x(n);
+	for (int i=0; i<n; i++) x[i]=random_interval(lo,hi,w);
+	return x;
+}
+
+IntervalMatrix random_matrix(int n, double lo, double hi, double w) {
+	IntervalMatrix A(n,n);
+	for (int i=0; i<n; i++)
+		A[i]=random_vector(n,lo,hi,w);
+	return A;
+}
+
+const int N=1024; // size of arrays for scalar operations
+
+Interval X[N], Y[N], Z[N];
+
+template<class Op>
+void scalar(const string& name, Op op) {
+	add(name, N, [op]() {
+		for (int i=0; i<N; i++) Z[i]=op(X[i],Y[i]);
+		keep(Z);
+	});
+}
+
+void register_interval() {
+	for (int i=0; i<N; i++) {
+		X[i]=random_interval(0.1,10,1);
+		Y[i]=random_interval(0.1,10,1);
+	}
+
+	scalar("Interval/add",   [](const Interval& x, const Interval& y) { return x+y; });
+	scalar("Interval/sub",   [](const Interval& x, const Interval& y) { return x-y; });
+	scalar("Interval/mul",   [](const Interval& x, const Interval& y) { return x*y; });
+	scalar("Interval/div",   [](const Interval& x, const Interval& y) { return x/y; });
+	scalar("Interval/inter", [](const Interval& x, const Interval& y) { return x&y; });
+	scalar("Interval/hull",  [](const Interval& x, const Interval& y) { return x|y; });
+	scalar("Interval/sqr",   [](const Interval& x, const Interval&)   { return sqr(x); });
+	scalar("Interval/sqrt",  [](const Interval& x, const Interval&)   { return sqrt(x); });
+	scalar("Interval/exp",   [](const Interval& x, const Interval&)   { return exp(x); });
+	scalar("Interval/log",   [](const Interval& x, const Interval&)   { return log(x); });
+	scalar("Interval/sin",   [](const Interval& x, const Interval&)   { return sin(x); });
+	scalar("Interval/cos",   [](const Interval& x, const Interval&)   { return cos(x); });
+	scalar("Interval/pow3",  [](const Interval& x, const Interval&)   { return pow(x,3); });
+	scalar("Interval/bwd_mul", [](const Interval& x, const Interval& y) {
+		Interval z=Interval(1,2), a=x, b=y;
+		bwd_mul(z,a,b);
+		return a;
+	});
+}
+
+void register_vector(int n) {
+	stringstream s;
+	s << "/" << n;
+	IntervalVector x=random_vector(n,-10,10,1);
+	IntervalVector y=random_vector(n,-10,10,1);
+
+	add("IntervalVector/add"+s.str(), 1, [x,y]() { IntervalVector z=x+y; keep(z); });
+	add("IntervalVector/add_assign"+s.str(), 1, [x,y]() mutable { x+=y; x-=y; keep(x); });
+	add("IntervalVector/dot"+s.str(), 1, [x,y]() { Interval z=x*y; keep(z); });
+	add("IntervalVector/hull"+s.str(), 1, [x,y]() { IntervalVector z=x|y; keep(z); });
+	add("IntervalVector/max_diam"+s.str(), 1, [x]() { double d=x.max_diam(); keep(d); });
+	add("IntervalVector/is_subset"+s.str(), 1, [x,y]() { bool b=x.is_subset(y); keep(b); });
+}
+
+void register_matrix(int n) {
+	stringstream s;
+	s << "/" << n;
+	IntervalMatrix A=random_matrix(n,-10,10,1);
+	IntervalMatrix B=random_matrix(n,-10,10,1);
+	IntervalVector x=random_vector(n,-10,10,1);
+
+	add("IntervalMatrix/mul_vector"+s.str(), 1, [A,x]() { IntervalVector y=A*x; keep(y); });
+	add("IntervalMatrix/mul"+s.str(), 1, [A,B]() { IntervalMatrix C=A*B; keep(C); });
+}
+
+void register_hc4revise(int n) {
+	stringstream s;
+	s << "/" << n;
+
+	// f(x) = sum x_i*x_{i+1} + sin(x_i)
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(n));
+	const ExprNode* e=&(x[0]*x[1]+sin(x[0]));
+	for (int i=1; i<n-1; i++) e=&(*e + x[i]*x[i+1] + sin(x[i]));
+
+	Function* f=new Function(x,*e);
+	functions.push_back(f);
+	IntervalVector box(n,Interval(-1,1));
+
+	add("HC4Revise/forward"+s.str(), 1, [f,box]() { Interval y=f->eval(box); keep(y); });
+	add("HC4Revise/forward_backward"+s.str(), 1, [f,box]() {
+		IntervalVector b(box);
+		f->backward(Interval(-0.5,0.5),b);
+		keep(b);
+	});
+	add("HC4Revise/gradient"+s.str(), 1, [f,box]() { IntervalVector g=f->gradient(box); keep(g); });
+}
+
+void register_gauss_seidel(int n) {
+	stringstream s;
+	s << "/" << n;
+
+	// diagonally dominant matrix
+	IntervalMatrix A=random_matrix(n,-1,1,0.1);
+	for (int i=0; i<n; i++) A[i][i]=Interval(2*n,2*n+0.1);
+	IntervalVector b=random_vector(n,-1,1,0.1);
+	IntervalVector x0(n,Interval(-10,10));
+
+	add("gauss_seidel"+s.str(), 1, [A,b,x0]() {
+		IntervalVector x(x0);
+		gauss_seidel(A,b,x);
+		keep(x);
+	});
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	args::ArgumentParser parser("********* Ibex kernel benchmarks *********.", "Measure the time per operation of interval kernels.");
+	args::HelpFlag help(parser, "help", "Display this help menu", {'h', "help"});
+	args::ValueFlag<string> filter(parser, "string", "Only run the benchmarks whose name contains this string.", {'f', "filter"});
+	args::ValueFlag<double> min_time(parser, "float", "Minimal time of each benchmark (in seconds). Default value is 0.2.", {"min-time"});
+	args::Flag csv(parser, "csv", "Output in CSV format.", {"csv"});
+
+	try {
+		parser.ParseCLI(argc, argv);
+	}
+	catch (args::Help&) {
+		cout << parser;
+		return 0;
+	}
+	catch (args::ParseError& e) {
+		cerr << e.what() << endl;
+		cerr << parser;
+		return 1;
+	}
+
+	double _min_time = min_time ? min_time.Get() : 0.2;
+
+	RNG::srand(1);
+
+	register_interval();
+	register_vector(10);
+	register_vector(100);
+	register_matrix(10);
+	register_matrix(50);
+	register_hc4revise(10);
+	register_hc4revise(100);
+	register_gauss_seidel(10);
+	register_gauss_seidel(50);
+
+	if (csv)
+		cout << "library,benchmark,ns_per_op,iterations" << endl;
+	else
+		cout << "interval library: " << _IBEX_INTERVAL_LIB_ << endl << endl
+		     << left << setw(36) << "benchmark" << right << setw(14) << "ns/op" << setw(14) << "iterations" << endl
+		     << string(64,'-') << endl;
+
+	for (vector<Bench*>::iterator it=benchs.begin(); it!=benchs.end(); ++it) {
+		Bench& b=**it;
+
+		if (filter && b.name.find(filter.Get())==string::npos) continue;
+
+		b.run(1); // warm-up
+
+		long iterations=1;
+		double t;
+		for (;;) {
+			double t0=now();
+			b.run(iterations);
+			t=now()-t0;
+			if (t>=_min_time || iterations>=(1L<<40)) break;
+			// aim at 1.5*min_time, at most x10 per step
+			long next=t>0 ? (long) (iterations*1.5*_min_time/t) : iterations*10;
+			iterations=std::min(std::max(next,iterations+1),iterations*10);
+		}
+
+		double ns=1e9*t/(iterations*(double) b.ops);
+
+		if (csv)
+			cout << _IBEX_INTERVAL_LIB_ << ',' << b.name << ',' << ns << ',' << iterations << endl;
+		else
+			cout << left << setw(36) << b.name << right << setw(14) << setprecision(4) << ns << setw(14) << iterations << endl;
+	}
+
+	for (vector<Bench*>::iterator it=benchs.begin(); it!=benchs.end(); ++it)
+		delete *it;
+
+	for (vector<Function*>::iterator it=functions.begin(); it!=functions.end(); ++it)
+		delete *it;
+
+	return 0;
+}
@@ -0,0 +1,259 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+//============================================================================
+//
+// Runs the default solver (resp. optimizer) on a list of systems (resp.
+// optimization problems) with a fixed random seed and a time limit, and
+// records for each benchmark the status, time, number of cells, number of
+// solutions and final uplo/loup.
+//
+// The results can be saved (CSV) and compared with a baseline produced by
+// a previous run: a benchmark is flagged when its status changes or when
+// its time or its number of cells increases by more than a given ratio.
+// The program returns 1 if at least one benchmark is flagged.
+//
+// Usage: benchmark [options] file1.bch file2.bch ...
+//        (see benchmark --help and the "bench" target in CMakeLists.txt)
+//
+//============================================================================
+
+#include "ibex.h"
+#include "parse_args.h"
+
+#include <fstream>
+#include <sstream>
+#include <map>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+struct Result {
+	string name;
+	string kind;    // "solve" or "optim"
+	string status;
+	double time;
+	double cells;
+	long solutions; // solver only (-1 otherwise)
+	double uplo;    // optimizer only
+	double loup;    // optimizer only
+};
+
+const char* solver_status[] = { "SUCCESS", "INFEASIBLE", "NOT_ALL_VALIDATED", "TIME_OUT", "CELL_OVERFLOW", "USER_BREAK" };
+
+const char* optim_status[] = { "SUCCESS", "INFEASIBLE", "NO_FEASIBLE_FOUND", "UNBOUNDED_OBJ", "TIME_OUT", "UNREACHED_PREC" };
+
+const char* csv_header = "name,kind,status,time,cells,solutions,uplo,loup";
+
+/*
+ * Name of a benchmark: the file name without the root prefix.
+ */
+string bench_name(const string& file, const string& root) {
+	if (!root.empty() && file.compare(0,root.size(),root)==0) {
+		string name=file.substr(root.size());
+		while (!name.empty() && name[0]=='/') name=name.substr(1);
+		return name;
+	}
+	return file;
+}
+
+void run(const System& sys, double time_limit, double random_seed, Result& r) {
+	if (sys.goal) {
+		r.kind="optim";
+		DefaultOptimizerConfig config(sys);
+		config.set_random_seed(random_seed);
+		config.set_timeout(time_limit);
+
+		Optimizer o(config);
+		Optimizer::Status status=o.optimize(sys.box);
+
+		r.status=optim_status[status];
+		r.time=o.get_time();
+		r.cells=o.get_nb_cells();
+		r.solutions=-1;
+		r.uplo=o.get_uplo();
+		r.loup=o.get_loup();
+	} else {
+		r.kind="solve";
+		DefaultSolver s(sys, DefaultSolver::default_eps_x_min, DefaultSolver::default_eps_x_max, true, random_seed);
+		s.time_limit=time_limit;
+
+		Solver::Status status=s.solve(sys.box);
+
+		r.status=solver_status[status];
+		r.time=s.get_time();
+		r.cells=s.get_nb_cells();
+		r.solutions=s.get_data().nb_solution();
+		r.uplo=NEG_INFINITY;
+		r.loup=POS_INFINITY;
+	}
+}
+
+void write(ostream& os, const Result& r) {
+	os << r.name << ',' << r.kind << ',' << r.status << ',' << r.time << ',' << r.cells << ',';
+	if (r.solutions>=0) os << r.solutions;
+	os << ',';
+	if (r.kind=="optim") os << r.uplo << ',' << r.loup;
+	else os << ',';
+	os << endl;
+}
+
+/*
+ * Read a CSV file generated by a previous run.
+ */
+map<string,Result> read_baseline(const char* filename) {
+	ifstream f(filename);
+	if (!f.is_open()) {
+		stringstream s;
+		s << "cannot open baseline file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	map<string,Result> baseline;
+	string line;
+	getline(f,line); // header
+
+	while (getline(f,line)) {
+		if (line.empty()) continue;
+		vector<string> fields;
+		stringstream ss(line);
+		string field;
+		while (getline(ss,field,',')) fields.push_back(field);
+		if (fields.size()<5) continue;
+
+		Result r;
+		r.name=fields[0];
+		r.kind=fields[1];
+		r.status=fields[2];
+		r.time=atof(fields[3].c_str());
+		r.cells=atof(fields[4].c_str());
+		r.solutions=fields.size()>5 && !fields[5].empty() ? atol(fields[5].c_str()) : -1;
+		r.uplo=fields.size()>6 && !fields[6].empty() ? atof(fields[6].c_str()) : NEG_INFINITY;
+		r.loup=fields.size()>7 && !fields[7].empty() ? atof(fields[7].c_str()) : POS_INFINITY;
+		baseline[r.name]=r;
+	}
+	return baseline;
+}
+
+/*
+ * Compare a result with the baseline. Return true if it is a regression.
+ */
+bool compare(const Result& r, const Result& b, double threshold, double min_time) {
+	bool regression=false;
+
+	if (r.status!=b.status) {
+		cout << "  " << r.name << ": status " << b.status << " -> " << r.status << endl;
+		regression=true;
+	}
+
+	if (r.time > b.time*(1+threshold) && r.time-b.time > min_time) {
+		cout << "  " << r.name << ": time " << b.time << "s -> " << r.time << "s" << endl;
+		regression=true;
+	}
+
+	if (r.cells > b.cells*(1+threshold)) {
+		cout << "  " << r.name << ": cells " << b.cells << " -> " << r.cells << endl;
+		regression=true;
+	}
+
+	return regression;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	args::ArgumentParser parser("********* Ibex benchmark *********.", "Run the default solver/optimizer on a list of benchmarks.");
+	args::HelpFlag help(parser, "help", "Display this help menu", {'h', "help"});
+	args::ValueFlag<double> time_limit(parser, "float", "Time limit per benchmark (in seconds). Default value is 10.", {'t', "time-limit"});
+	args::ValueFlag<double> random_seed(parser, "float", "Random seed. Default value is 1.", {"random-seed"});
+	args::ValueFlag<string> root(parser, "dir", "Root directory, removed from the file names to name the benchmarks.", {"root"});
+	args::ValueFlag<string> output(parser, "filename", "CSV output file (results of this run).", {'o', "output"});
+	args::ValueFlag<string> baseline(parser, "filename", "CSV file of a previous run to compare with.", {'b', "baseline"});
+	args::ValueFlag<double> threshold(parser, "float", "Relative increase of time or cells above which a benchmark is flagged. Default value is 0.2 (+20%).", {"threshold"});
+	args::ValueFlag<double> min_time(parser, "float", "Increase of time (in seconds) under which a benchmark is never flagged (timing noise). Default value is 0.1.", {"min-time"});
+	args::PositionalList<string> files(parser, "files", "The benchmark files (MINIBEX).");
+
+	try {
+		parser.ParseCLI(argc, argv);
+	}
+	catch (args::Help&) {
+		cout << parser;
+		return 0;
+	}
+	catch (args::ParseError& e) {
+		cerr << e.what() << endl;
+		cerr << parser;
+		return 1;
+	}
+	catch (args::ValidationError& e) {
+		cerr << e.what() << endl;
+		cerr << parser;
+		return 1;
+	}
+
+	double _time_limit = time_limit ? time_limit.Get() : 10;
+	double _random_seed = random_seed ? random_seed.Get() : 1;
+	double _threshold = threshold ? threshold.Get() : 0.2;
+	double _min_time = min_time ? min_time.Get() : 0.1;
+	string _root = root ? root.Get() : "";
+
+	map<string,Result> base;
+	if (baseline) base=read_baseline(baseline.Get().c_str());
+
+	ofstream out;
+	if (output) {
+		out.open(output.Get().c_str());
+		if (!out.is_open()) ibex_error("cannot open output file");
+		out << csv_header << endl;
+	}
+
+	cout << csv_header << endl;
+
+	vector<Result> results;
+
+	for (vector<string>::const_iterator it=files.Get().begin(); it!=files.Get().end(); ++it) {
+		Result r;
+		r.name=bench_name(*it,_root);
+
+		try {
+			System sys(it->c_str());
+			run(sys, _time_limit, _random_seed, r);
+		} catch(SyntaxError&) {
+			r.kind="-"; r.status="ERROR"; r.time=0; r.cells=0; r.solutions=-1;
+		} catch(UnknownFileException&) {
+			r.kind="-"; r.status="ERROR"; r.time=0; r.cells=0; r.solutions=-1;
+		}
+
+		write(cout,r);
+		if (output) write(out,r);
+		results.push_back(r);
+	}
+
+	if (!baseline) return 0;
+
+	cout << endl << "Comparison with " << baseline.Get() << " (threshold=+" << (int) (100*_threshold) << "%):" << endl;
+
+	int nb_regressions=0;
+	double total_time=0, total_base_time=0;
+
+	for (vector<Result>::const_iterator it=results.begin(); it!=results.end(); ++it) {
+		map<string,Result>::const_iterator b=base.find(it->name);
+		if (b==base.end()) {
+			cout << "  " << it->name << ": not in baseline" << endl;
+			continue;
+		}
+		total_time += it->time;
+		total_base_time += b->second.time;
+		if (compare(*it, b->second, _threshold, _min_time)) nb_regressions++;
+	}
+
+	cout << endl << "total time: " << total_base_time << "s -> " << total_time << "s" << endl;
+	cout << nb_regressions << " regression(s)" << endl;
+
+	return nb_regressions>0 ? 1 : 0;
+}
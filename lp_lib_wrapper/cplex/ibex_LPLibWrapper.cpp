@@ -75,6 +75,7 @@ int LPSolver::add_constraint(double lhs, const Vector& row, double rhs) {
     assert(isfinite(row));
 
     has_changed = true;
+    rows_changed_ = true;
 	IloRange range(env, lhs, rhs);
 	range.setLinearCoefs(x, ivec2ilonumarray(env, row));
 	constraints.add(range);
@@ -88,6 +89,7 @@ int LPSolver::add_constraint(const Vector& row, CmpOp op, double rhs) {
     assert(isfinite(row));
 
     has_changed = true;
+    rows_changed_ = true;
 	IloRange range(env, -IloInfinity, IloInfinity);
 	switch(op) {
 	case ibex::LT:
@@ -211,6 +213,7 @@ void LPSolver::set_bounds(const IntervalVector& bounds) {
     assert(bounds.size() == nb_vars());
     assert(!bounds.is_unbounded());
     has_changed = true;
+    lhs_rhs_changed_ = true;
     for(int i = 0; i < nb_vars(); ++i) {
 		set_bounds(i, bounds[i]);
 	}
@@ -221,6 +224,7 @@ void LPSolver::set_bounds(int var, const Interval& bounds) {
     assert(!bounds.is_unbounded());
 
     has_changed = true;
+    lhs_rhs_changed_ = true;
     ivec_bounds_[var] = bounds;
 	x[var].setBounds(bounds.lb(), bounds.ub());
 	constraints[var].setBounds(bounds.lb(), bounds.ub());
@@ -398,6 +402,7 @@ void LPSolver::set_cost_to_zero() {
 }
 
 void LPSolver::clear_constraints() {
+    rows_changed_ = true;
     for(int i = nb_vars(); i < nb_rows(); ++i) {
         constraints[i].end();
     }
@@ -414,6 +419,7 @@ void LPSolver::clear_bounds() {
 void LPSolver::reset(int nb_vars) {
 	assert(nb_vars > 0);
 	invalidate();
+	rows_changed_ = true;
 
 	// Create
 	cost_.setConstant(0);
@@ -0,0 +1,1315 @@
+#include "ibex_LPSolver.h"
+
+#include <vector>
+#include <map>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+
+namespace ibex {
+
+/*
+ * Dense bounded-variable dual simplex.
+ *
+ * The LP
+ *
+ *     min c^T x  s.t.  lhs <= Ax <= rhs,  lb <= x <= ub
+ *
+ * (A is m x n) is solved in the form Ax - s = 0 with the n+m variables
+ * z=(x,s) bounded by (lb,lhs) and (ub,rhs): variable j<n is x_j and
+ * variable n+i is the slack of row i.
+ *
+ * Infinite bounds (and bounds larger than 1e100) are replaced by
+ * artificial ones: the bound of a slack is the range of its row on the
+ * box (plus a margin), which does not change the feasible set, and the
+ * bound of a variable is a large value, multiplied by 1000 each time it
+ * turns out to be active at the end (until 1e100, where the LP is
+ * declared unbounded). As all the variables are bounded, any basis is made
+ * dual feasible by putting each nonbasic variable at the bound given by
+ * the sign of its reduced cost: the dual simplex needs no phase 1 and the
+ * basis of the previous call can always be reused, whatever the new cost
+ * and bounds are.
+ *
+ * Rows and columns are scaled (by powers of 2) each time the matrix
+ * changes.
+ *
+ * The inverse of the basis matrix is stored explicitly (m x m), updated
+ * at each pivot and recomputed from scratch periodically. Primal values
+ * and reduced costs are recomputed at each iteration, which costs as
+ * much as the update of the inverse for dense matrices and avoids any
+ * numerical drift.
+ */
+class DenseSimplex {
+public:
+	enum VarStatus { BASIC, AT_LB, AT_UB };
+
+	enum Result { OPTIMAL, INFEASIBLE, UNBOUNDED, MAX_ITER, TIMEOUT };
+
+	DenseSimplex();
+
+	/*
+	 * Remove all the rows and set the number of variables.
+	 * Bounds are ]-oo,+oo[ and the cost is zero.
+	 */
+	void reset(int n);
+
+	void add_row(double lhs, const Vector& row, double rhs);
+
+	/*
+	 * Remove the rows first, first+1, ...
+	 * The current basis is saved and reused by the next call to solve()
+	 * if the same number of rows is added in the meantime.
+	 */
+	void remove_rows(int first);
+
+	Result solve();
+
+	int n, m;
+	std::vector<double> a;  // m x n, by rows
+	std::vector<double> lhs, rhs;
+	std::vector<double> lb, ub, cost;
+
+	double tolerance;
+	double timeout;
+	int max_iter;
+
+	// results of solve()
+	std::vector<double> primal; // (n)
+	std::vector<double> dual;   // duals of the rows (m)
+	std::vector<double> farkas; // infeasibility certificate (m)
+	double obj;
+
+private:
+	static constexpr double infinite_bound = 1e100;
+	static constexpr double art_factor = 1e3;
+	static const int refactor_freq = 64;
+	static const int scaling_passes = 8;
+
+	void compute_scaling();
+	void compute_bounds(double art);
+	double initial_art() const;
+	bool at_artificial_bound(const std::vector<double>* alpha) const;
+	bool factorize();
+	void slack_basis();
+	void refactor();
+	void compute_duals();
+	void fit_nonbasic();
+	void compute_primal();
+	void compute_weights();
+	int pricing(bool& below) const;
+	double pivot_tolerance(const std::vector<double>& alpha) const;
+	int ratio_test(int r, bool below, std::vector<double>& alpha) const;
+	void pivot(int r, int q, bool below, const std::vector<double>& alpha);
+
+	// The simplex works on the scaled LP: the coefficient (i,j) is multiplied
+	// by row_scale[i]*col_scale[j] and the variable x_j is divided by col_scale[j].
+	std::vector<double> row_scale, col_scale;
+	std::vector<double> sa;       // scaled matrix
+	std::vector<double> sc;       // scaled cost
+
+	std::vector<double> lo, up;   // finite bounds of the n+m variables
+	std::vector<char> art_lo, art_up; // true if the bound is artificial
+	std::vector<double> z;        // values (n+m)
+	std::vector<double> y;        // duals of the rows (m)
+	std::vector<double> d;        // reduced costs (n+m)
+	std::vector<double> d_err;    // rounding error on the reduced costs (n+m)
+	std::vector<double> err;      // rounding error on the basic variables (m)
+	std::vector<double> weight;   // squared norms of the rows of B^{-1} (m)
+	std::vector<int> status;      // n+m
+	std::vector<int> warm;        // basis saved by remove_rows()
+	std::vector<int> head;        // basic variable of each row
+	std::vector<double> binv;     // inverse of the basis matrix (m x m)
+	bool factorized;
+};
+
+
+DenseSimplex::DenseSimplex() : n(0), m(0), tolerance(LPSolver::default_tolerance),
+		timeout(LPSolver::default_timeout), max_iter(LPSolver::default_max_iter),
+		obj(0), factorized(false) {
+}
+
+void DenseSimplex::reset(int n) {
+	this->n=n;
+	m=0;
+	a.clear();
+	lhs.clear();
+	rhs.clear();
+	lb.assign(n,NEG_INFINITY);
+	ub.assign(n,POS_INFINITY);
+	cost.assign(n,0.0);
+	status.assign(n,AT_LB);
+	warm.clear();
+	head.clear();
+	factorized=false;
+}
+
+void DenseSimplex::add_row(double lhs, const Vector& row, double rhs) {
+	for (int j=0; j<n; j++) a.push_back(row[j]);
+	this->lhs.push_back(lhs);
+	this->rhs.push_back(rhs);
+	status.push_back(BASIC);
+	m++;
+	factorized=false;
+}
+
+void DenseSimplex::remove_rows(int first) {
+	if (first>=m) return;
+	if (factorized) warm=status;
+	a.resize(first*n);
+	lhs.resize(first);
+	rhs.resize(first);
+	status.resize(n+first);
+	m=first;
+	factorized=false;
+}
+
+void DenseSimplex::compute_scaling() {
+	row_scale.assign(m,1.0);
+	col_scale.assign(n,1.0);
+
+	// geometric scaling: each row (resp. column) is divided by the
+	// geometric mean of its smallest and largest coefficient
+	for (int pass=0; pass<scaling_passes; pass++) {
+		for (int i=0; i<m; i++) {
+			double amin=POS_INFINITY, amax=0;
+			for (int j=0; j<n; j++) {
+				double v=std::fabs(a[i*n+j])*col_scale[j];
+				if (v==0) continue;
+				amin=std::min(amin,v);
+				amax=std::max(amax,v);
+			}
+			if (amax>0) row_scale[i]=1/std::sqrt(amin*amax);
+		}
+		for (int j=0; j<n; j++) {
+			double amin=POS_INFINITY, amax=0;
+			for (int i=0; i<m; i++) {
+				double v=std::fabs(a[i*n+j])*row_scale[i];
+				if (v==0) continue;
+				amin=std::min(amin,v);
+				amax=std::max(amax,v);
+			}
+			if (amax>0) col_scale[j]=1/std::sqrt(amin*amax);
+		}
+	}
+
+	// powers of 2: scaling does not introduce rounding errors
+	for (int i=0; i<m; i++) row_scale[i]=std::exp2(std::round(std::log2(row_scale[i])));
+	for (int j=0; j<n; j++) col_scale[j]=std::exp2(std::round(std::log2(col_scale[j])));
+
+	sa.resize(m*n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++)
+			sa[i*n+j]=a[i*n+j]*row_scale[i]*col_scale[j];
+}
+
+void DenseSimplex::compute_bounds(double art) {
+	lo.resize(n+m);
+	up.resize(n+m);
+	art_lo.resize(n+m);
+	art_up.resize(n+m);
+
+	for (int j=0; j<n; j++) {
+		art_lo[j]= lb[j]<=-infinite_bound;
+		art_up[j]= ub[j]>=infinite_bound;
+		lo[j]= art_lo[j] ? -art : lb[j]/col_scale[j];
+		up[j]= art_up[j] ? art : ub[j]/col_scale[j];
+	}
+
+	for (int i=0; i<m; i++) {
+		const double* ai=&sa[i*n];
+		double smin=0, smax=0;
+		for (int j=0; j<n; j++) {
+			if (ai[j]>0)      { smin+=ai[j]*lo[j]; smax+=ai[j]*up[j]; }
+			else if (ai[j]<0) { smin+=ai[j]*up[j]; smax+=ai[j]*lo[j]; }
+		}
+		double margin=1+1e-6*std::max(std::fabs(smin),std::fabs(smax));
+		art_lo[n+i]= lhs[i]<=-infinite_bound;
+		art_up[n+i]= rhs[i]>=infinite_bound;
+		lo[n+i]= art_lo[n+i] ? smin-margin : lhs[i]*row_scale[i];
+		up[n+i]= art_up[n+i] ? smax+margin : rhs[i]*row_scale[i];
+	}
+}
+
+double DenseSimplex::initial_art() const {
+	double max_bound=1;
+	for (int j=0; j<n; j++) {
+		if (std::fabs(lb[j])<infinite_bound) max_bound=std::max(max_bound,std::fabs(lb[j]/col_scale[j]));
+		if (std::fabs(ub[j])<infinite_bound) max_bound=std::max(max_bound,std::fabs(ub[j]/col_scale[j]));
+	}
+	for (int i=0; i<m; i++) {
+		if (std::fabs(lhs[i])<infinite_bound) max_bound=std::max(max_bound,std::fabs(lhs[i]*row_scale[i]));
+		if (std::fabs(rhs[i])<infinite_bound) max_bound=std::max(max_bound,std::fabs(rhs[i]*row_scale[i]));
+	}
+	return art_factor*max_bound;
+}
+
+bool DenseSimplex::at_artificial_bound(const std::vector<double>* alpha) const {
+	double piv_tol= alpha ? pivot_tolerance(*alpha) : 0;
+
+	for (int j=0; j<n+m; j++) {
+		if (status[j]==BASIC) continue;
+		if (!(status[j]==AT_LB ? art_lo[j] : art_up[j])) continue;
+		if (alpha) {
+			if (std::fabs((*alpha)[j])>piv_tol) return true;
+		} else if (std::fabs(d[j])>tolerance+d_err[j])
+			return true;
+	}
+	return false;
+}
+
+bool DenseSimplex::factorize() {
+	head.clear();
+	for (int j=0; j<n+m; j++)
+		if (status[j]==BASIC) head.push_back(j);
+
+	if ((int) head.size()!=m) return false;
+
+	// The basic slacks are eliminated: if X are the basic columns of A and
+	// R the rows whose slack is not basic, only the square block A(R,X)
+	// has to be inverted, the rows of B^-1 of the basic slacks follow.
+	std::vector<int> xpos, rows;
+	std::vector<bool> slack_row(m,false);
+	for (int k=0; k<m; k++) {
+		if (head[k]<n) xpos.push_back(k);
+		else slack_row[head[k]-n]=true;
+	}
+	for (int i=0; i<m; i++)
+		if (!slack_row[i]) rows.push_back(i);
+
+	int p=xpos.size();
+	if ((int) rows.size()!=p) return false;
+
+	std::vector<double> b(p*p);
+	std::vector<double> inv(p*p,0.0);
+	std::vector<double> col_max(p,0.0);
+	for (int c=0; c<p; c++) {
+		int j=head[xpos[c]];
+		for (int i=0; i<m; i++)
+			col_max[c]=std::max(col_max[c],std::fabs(sa[i*n+j]));
+		for (int r=0; r<p; r++)
+			b[r*p+c]=sa[rows[r]*n+j];
+		inv[c*p+c]=1;
+	}
+
+	// Gauss-Jordan with partial pivoting
+	for (int c=0; c<p; c++) {
+		int l=c;
+		for (int i=c+1; i<p; i++)
+			if (std::fabs(b[i*p+c])>std::fabs(b[l*p+c])) l=i;
+
+		if (std::fabs(b[l*p+c])<=1e-13*col_max[c]) return false;
+
+		if (l!=c) {
+			std::swap_ranges(&b[l*p], &b[l*p]+p, &b[c*p]);
+			std::swap_ranges(&inv[l*p], &inv[l*p]+p, &inv[c*p]);
+		}
+
+		double piv=b[c*p+c];
+		for (int k=0; k<p; k++) {
+			b[c*p+k]/=piv;
+			inv[c*p+k]/=piv;
+		}
+
+		for (int i=0; i<p; i++) {
+			double f=b[i*p+c];
+			if (i==c || f==0) continue;
+			for (int k=0; k<p; k++) {
+				b[i*p+k]-=f*b[c*p+k];
+				inv[i*p+k]-=f*inv[c*p+k];
+			}
+		}
+	}
+
+	binv.assign(m*m,0.0);
+	for (int c=0; c<p; c++)
+		for (int r=0; r<p; r++)
+			binv[xpos[c]*m+rows[r]]=inv[c*p+r];
+
+	// the slack of row i is A(i,X) x_X - (A x)_i
+	for (int k=0; k<m; k++) {
+		if (head[k]<n) continue;
+		int i=head[k]-n;
+		double* row=&binv[k*m];
+		row[i]=-1;
+		for (int c=0; c<p; c++) {
+			double a=sa[i*n+head[xpos[c]]];
+			if (a==0) continue;
+			for (int r=0; r<p; r++)
+				row[rows[r]]+=a*inv[c*p+r];
+		}
+	}
+	factorized=true;
+	return true;
+}
+
+void DenseSimplex::slack_basis() {
+	head.resize(m);
+	binv.assign(m*m,0.0);
+	for (int j=0; j<n; j++) status[j]=AT_LB;
+	for (int i=0; i<m; i++) {
+		status[n+i]=BASIC;
+		head[i]=n+i;
+		binv[i*m+i]=-1;
+	}
+	factorized=true;
+}
+
+void DenseSimplex::refactor() {
+	if (!factorize()) slack_basis();
+}
+
+void DenseSimplex::compute_duals() {
+	// y = c_B^T B^{-1}
+	y.assign(m,0.0);
+	for (int k=0; k<m; k++) {
+		int j=head[k];
+		if (j>=n || sc[j]==0) continue;
+		const double* row=&binv[k*m];
+		for (int i=0; i<m; i++) y[i]+=sc[j]*row[i];
+	}
+
+	// d = c - M^T y  with M=(A -I)
+	d.resize(n+m);
+	d_err.resize(n+m);
+	for (int j=0; j<n; j++) {
+		d[j]=sc[j];
+		d_err[j]=std::fabs(sc[j]);
+	}
+	for (int i=0; i<m; i++) {
+		if (y[i]==0) continue;
+		const double* ai=&sa[i*n];
+		for (int j=0; j<n; j++) {
+			d[j]-=y[i]*ai[j];
+			d_err[j]+=std::fabs(y[i]*ai[j]);
+		}
+	}
+	for (int j=0; j<n; j++) d_err[j]*=m*1e-16;
+	for (int i=0; i<m; i++) {
+		d[n+i]=y[i];
+		d_err[n+i]=0;
+	}
+	for (int k=0; k<m; k++) d[head[k]]=0;
+}
+
+void DenseSimplex::fit_nonbasic() {
+	z.resize(n+m);
+	for (int j=0; j<n+m; j++) {
+		if (status[j]==BASIC) continue;
+		if (lo[j]==up[j]) status[j]=AT_LB;
+		else if (d[j]>tolerance+d_err[j]) status[j]=AT_LB;
+		else if (d[j]<-tolerance-d_err[j]) status[j]=AT_UB;
+		z[j]= status[j]==AT_LB ? lo[j] : up[j];
+	}
+}
+
+void DenseSimplex::compute_primal() {
+	// w = N z_N
+	std::vector<double> w(m), w_abs(m);
+	for (int i=0; i<m; i++) {
+		const double* ai=&sa[i*n];
+		double s=0, s_abs=0;
+		for (int j=0; j<n; j++)
+			if (status[j]!=BASIC) {
+				s+=ai[j]*z[j];
+				s_abs+=std::fabs(ai[j]*z[j]);
+			}
+		if (status[n+i]!=BASIC) {
+			s-=z[n+i];
+			s_abs+=std::fabs(z[n+i]);
+		}
+		w[i]=s;
+		w_abs[i]=s_abs;
+	}
+
+	// z_B = -B^{-1} N z_N
+	err.resize(m);
+	for (int k=0; k<m; k++) {
+		const double* row=&binv[k*m];
+		double s=0, s_abs=0;
+		for (int i=0; i<m; i++) {
+			s+=row[i]*w[i];
+			s_abs+=std::fabs(row[i])*w_abs[i];
+		}
+		z[head[k]]=-s;
+		// rounding errors (significant when some variables are
+		// at huge bounds)
+		err[k]=(n+m)*1e-16*s_abs;
+	}
+}
+
+void DenseSimplex::compute_weights() {
+	weight.resize(m);
+	for (int k=0; k<m; k++) {
+		const double* row=&binv[k*m];
+		double w=0;
+		for (int i=0; i<m; i++) w+=row[i]*row[i];
+		weight[k]=w;
+	}
+}
+
+int DenseSimplex::pricing(bool& below) const {
+	// Dual steepest edge: the infeasibility is divided by the norm
+	// of the row of B^{-1}.
+	int r=-1;
+	double best=0;
+	for (int k=0; k<m; k++) {
+		int j=head[k];
+		double viol;
+		bool low;
+		if (z[j]<lo[j]-tolerance*(1+std::fabs(lo[j]))-err[k]) {
+			viol=lo[j]-z[j];
+			low=true;
+		} else if (z[j]>up[j]+tolerance*(1+std::fabs(up[j]))+err[k]) {
+			viol=z[j]-up[j];
+			low=false;
+		} else
+			continue;
+
+		double score=viol*viol/weight[k];
+		if (score>best) {
+			best=score;
+			r=k;
+			below=low;
+		}
+	}
+	return r;
+}
+
+double DenseSimplex::pivot_tolerance(const std::vector<double>& alpha) const {
+	double alpha_max=0;
+	for (int j=0; j<n+m; j++)
+		if (status[j]!=BASIC) alpha_max=std::max(alpha_max,std::fabs(alpha[j]));
+	return std::max(1e-11,1e-14*alpha_max);
+}
+
+int DenseSimplex::ratio_test(int r, bool below, std::vector<double>& alpha) const {
+	// alpha = row r of B^{-1} M
+	const double* rho=&binv[r*m];
+	alpha.assign(n+m,0.0);
+	for (int i=0; i<m; i++) {
+		if (rho[i]==0) continue;
+		const double* ai=&sa[i*n];
+		for (int j=0; j<n; j++) alpha[j]+=rho[i]*ai[j];
+		alpha[n+i]=-rho[i];
+	}
+
+	double piv_tol=pivot_tolerance(alpha);
+
+	// The dual step t>=0 changes the reduced cost of j by -sign*t*alpha[j].
+	// Entering candidates are the variables whose reduced cost goes to zero,
+	// i.e., at lower bound with sign*alpha>0 or at upper bound with
+	// sign*alpha<0. The ratio test is Harris' two-pass test.
+	double sign= below ? -1 : 1;
+	double theta_max=POS_INFINITY;
+	for (int j=0; j<n+m; j++) {
+		if (status[j]==BASIC || lo[j]==up[j]) continue;
+		double s=sign*alpha[j];
+		if (status[j]==AT_LB ? s>piv_tol : s<-piv_tol) {
+			double g=std::fabs(d[j])+tolerance;
+			theta_max=std::min(theta_max,g/std::fabs(alpha[j]));
+		}
+	}
+
+	if (theta_max==POS_INFINITY) return -1;
+
+	int q=-1;
+	double best=0;
+	for (int j=0; j<n+m; j++) {
+		if (status[j]==BASIC || lo[j]==up[j]) continue;
+		double s=sign*alpha[j];
+		if (status[j]==AT_LB ? s>piv_tol : s<-piv_tol) {
+			if (std::fabs(d[j])/std::fabs(alpha[j])<=theta_max && std::fabs(alpha[j])>best) {
+				best=std::fabs(alpha[j]);
+				q=j;
+			}
+		}
+	}
+	return q;
+}
+
+void DenseSimplex::pivot(int r, int q, bool below, const std::vector<double>& alpha) {
+	// col = B^{-1} M_q
+	std::vector<double> col(m,0.0);
+	if (q<n) {
+		for (int i=0; i<m; i++) {
+			double aiq=sa[i*n+q];
+			if (aiq==0) continue;
+			for (int k=0; k<m; k++) col[k]+=binv[k*m+i]*aiq;
+		}
+	} else
+		for (int k=0; k<m; k++) col[k]=-binv[k*m+q-n];
+
+	int leaving=head[r];
+	double target= below ? lo[leaving] : up[leaving];
+
+	// primal step: z_q moves so that the leaving variable reaches its bound
+	double theta_p=(z[leaving]-target)/col[r];
+	for (int k=0; k<m; k++)
+		if (col[k]!=0) z[head[k]]-=theta_p*col[k];
+	z[q]+=theta_p;
+	z[leaving]=target;
+	err[r]=0;
+
+	// dual step: the reduced cost of q goes to zero
+	double theta_d=d[q]/alpha[q];
+	const double* rho=&binv[r*m];
+	for (int i=0; i<m; i++) y[i]+=theta_d*rho[i];
+	for (int j=0; j<n+m; j++)
+		if (status[j]!=BASIC) d[j]-=theta_d*alpha[j];
+	d[leaving]=-theta_d;
+	d[q]=0;
+
+	// update of B^{-1} and of the weights of the pricing
+	double* row_r=&binv[r*m];
+	double piv=col[r];
+	double w_r=0;
+	for (int i=0; i<m; i++) {
+		row_r[i]/=piv;
+		w_r+=row_r[i]*row_r[i];
+	}
+
+	for (int k=0; k<m; k++) {
+		if (k==r || col[k]==0) continue;
+		double* row=&binv[k*m];
+		double f=col[k];
+		double dot=0;
+		for (int i=0; i<m; i++) {
+			dot+=row[i]*row_r[i];
+			row[i]-=f*row_r[i];
+		}
+		weight[k]=std::max(weight[k]-2*f*dot+f*f*w_r, 1e-12);
+	}
+	weight[r]=w_r;
+
+	status[leaving]= below ? AT_LB : AT_UB;
+	status[q]=BASIC;
+	head[r]=q;
+}
+
+DenseSimplex::Result DenseSimplex::solve() {
+	if (!factorized) compute_scaling();
+
+	sc.resize(n);
+	for (int j=0; j<n; j++) sc[j]=cost[j]*col_scale[j];
+
+	double art=initial_art();
+	compute_bounds(art);
+
+	for (int j=0; j<n+m; j++) {
+		if (lo[j]>up[j]) {
+			farkas.assign(m,0.0);
+			if (j>=n) farkas[j-n]=1;
+			return INFEASIBLE;
+		}
+	}
+
+	if (!factorized) {
+		if (warm.size()==status.size()) status=warm;
+		warm.clear();
+		refactor();
+	}
+
+	std::chrono::steady_clock::time_point start=std::chrono::steady_clock::now();
+
+	// a (degenerate) cycle cannot last forever
+	int iter_limit= max_iter>=0 ? max_iter : 100*(n+m)+1000;
+	int iter=0;
+	int since_refactor=0;
+	std::vector<double> alpha;
+
+	bool recompute=true; // compute the values from scratch
+	bool exact=false;    // values computed from scratch since the last pivot
+
+	for (;;) {
+		if (recompute) {
+			compute_duals();
+			fit_nonbasic();
+			compute_primal();
+			compute_weights();
+			recompute=false;
+			exact=true;
+		}
+
+		bool below=false;
+		int r=pricing(below);
+
+		if (r==-1) {
+			// check with values computed from scratch before concluding
+			if (!exact) {
+				recompute=true;
+				continue;
+			}
+			if (!at_artificial_bound(NULL)) break;
+			// the artificial bounds are too small (or the LP is unbounded)
+			if (art>=infinite_bound) return UNBOUNDED;
+			art*=art_factor;
+			compute_bounds(art);
+			recompute=true;
+			continue;
+		}
+
+		if (iter>=iter_limit) return MAX_ITER;
+
+		if (std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count()>timeout)
+			return TIMEOUT;
+
+		int q=ratio_test(r,below,alpha);
+
+		if (q==-1) {
+			// check with a fresh inverse before concluding
+			if (since_refactor>0) {
+				refactor();
+				since_refactor=0;
+				recompute=true;
+				continue;
+			}
+			// the proof must not rely on artificial bounds
+			if (art<infinite_bound && at_artificial_bound(&alpha)) {
+				art*=art_factor;
+				compute_bounds(art);
+				recompute=true;
+				continue;
+			}
+			// Row r of B^{-1} combines the rows into a constraint
+			// that cannot be satisfied on the box.
+			farkas.resize(m);
+			for (int i=0; i<m; i++) farkas[i]=binv[r*m+i]*row_scale[i];
+			return INFEASIBLE;
+		}
+
+		pivot(r,q,below,alpha);
+		exact=false;
+		iter++;
+
+		if (++since_refactor>=refactor_freq) {
+			refactor();
+			since_refactor=0;
+			recompute=true;
+		}
+	}
+
+	primal.resize(n);
+	obj=0;
+	for (int j=0; j<n; j++) {
+		primal[j]=z[j]*col_scale[j];
+		obj+=cost[j]*primal[j];
+	}
+	dual.resize(m);
+	for (int i=0; i<m; i++) dual[i]=y[i]*row_scale[i];
+
+	return OPTIMAL;
+}
+
+} // end namespace ibex
+
+namespace {
+
+ibex::Vector std2ivec(const std::vector<double>& v, int size) {
+	ibex::Vector ivec(size);
+	for(int i = 0; i < size; ++i) {
+		ivec[i] = v[i];
+	}
+	return ivec;
+}
+
+bool isfinite(const ibex::Vector& v) {
+	for(int i = 0; i < v.size(); ++i) {
+		if(!std::isfinite(v[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Infinite bounds read in a file are replaced by this value (as
+// with SoPlex), so that the LP can be copied with add_constraints
+// and set_bounds. The simplex considers it as infinite anyway.
+const double mps_infinity = 1e100;
+
+double mps_bound(double x) {
+	return x==POS_INFINITY ? mps_infinity : (x==NEG_INFINITY ? -mps_infinity : x);
+}
+
+// Read a LP in (fixed or free) MPS format.
+// Names must not contain spaces. Integrality markers are ignored.
+bool read_mps(const std::string& filename, ibex::DenseSimplex& lp) {
+	std::ifstream f(filename.c_str());
+	if(!f.is_open()) {
+		return false;
+	}
+
+	enum { NONE, ROWS, COLUMNS, RHS, RANGES, BOUNDS } section = NONE;
+
+	std::string obj_row;
+	std::map<std::string, int> rows, cols;
+	std::vector<char> types;
+	std::vector<double> rhs, range, lb, ub, cost;
+	std::vector<std::map<int, double> > entries; // by column
+
+	std::string line;
+	while(std::getline(f, line)) {
+		if(line.empty() || line[0] == '*') continue;
+
+		std::istringstream ss(line);
+		std::vector<std::string> tok;
+		std::string t;
+		while(ss >> t) tok.push_back(t);
+		if(tok.empty()) continue;
+
+		if(line[0] != ' ' && line[0] != '\t') {
+			if(tok[0] == "ROWS") section = ROWS;
+			else if(tok[0] == "COLUMNS") section = COLUMNS;
+			else if(tok[0] == "RHS") section = RHS;
+			else if(tok[0] == "RANGES") section = RANGES;
+			else if(tok[0] == "BOUNDS") section = BOUNDS;
+			else if(tok[0] == "ENDATA") break;
+			else section = NONE; // NAME, OBJSENSE, ...
+			continue;
+		}
+
+		switch(section) {
+		case ROWS:
+			if(tok.size() < 2) return false;
+			if(tok[0] == "N") {
+				if(obj_row.empty()) obj_row = tok[1];
+			} else {
+				rows[tok[1]] = types.size();
+				types.push_back(tok[0][0]);
+				rhs.push_back(0);
+				range.push_back(NAN);
+			}
+			break;
+		case COLUMNS:
+			{
+				if(line.find("MARKER") != std::string::npos) break;
+				if(tok.size() < 3) return false;
+				std::map<std::string, int>::iterator c = cols.find(tok[0]);
+				int j;
+				if(c == cols.end()) {
+					j = cols.size();
+					cols[tok[0]] = j;
+					lb.push_back(0);
+					ub.push_back(POS_INFINITY);
+					cost.push_back(0);
+					entries.push_back(std::map<int, double>());
+				} else {
+					j = c->second;
+				}
+				for(size_t k = 1; k+1 < tok.size(); k += 2) {
+					double v = atof(tok[k+1].c_str());
+					if(tok[k] == obj_row) {
+						cost[j] = v;
+					} else {
+						std::map<std::string, int>::iterator r = rows.find(tok[k]);
+						if(r == rows.end()) return false;
+						entries[j][r->second] = v;
+					}
+				}
+			}
+			break;
+		case RHS:
+		case RANGES:
+			// the name of the vector is optional
+			for(size_t k = tok.size() % 2; k+1 < tok.size(); k += 2) {
+				std::map<std::string, int>::iterator r = rows.find(tok[k]);
+				if(r == rows.end()) continue; // objective constant
+				(section == RHS ? rhs : range)[r->second] = atof(tok[k+1].c_str());
+			}
+			break;
+		case BOUNDS:
+			{
+				const std::string& type = tok[0];
+				bool has_value = !(type == "FR" || type == "MI" || type == "PL" || type == "BV");
+				// the name of the bound vector is optional
+				if(tok.size() < (has_value ? 3u : 2u)) return false;
+				size_t k = tok.size() - (has_value ? 2 : 1);
+				std::map<std::string, int>::iterator c = cols.find(tok[k]);
+				if(c == cols.end()) return false;
+				int j = c->second;
+				double v = has_value ? atof(tok[k+1].c_str()) : 0;
+				if(type == "UP" || type == "UI") {
+					ub[j] = v;
+					if(v < 0 && lb[j] == 0) lb[j] = NEG_INFINITY;
+				}
+				else if(type == "LO" || type == "LI") lb[j] = v;
+				else if(type == "FX") lb[j] = ub[j] = v;
+				else if(type == "FR") { lb[j] = NEG_INFINITY; ub[j] = POS_INFINITY; }
+				else if(type == "MI") lb[j] = NEG_INFINITY;
+				else if(type == "PL") ub[j] = POS_INFINITY;
+				else if(type == "BV") { lb[j] = 0; ub[j] = 1; }
+				else return false;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	int n = cols.size();
+	if(n == 0) return false;
+
+	lp.reset(n);
+	for(int j = 0; j < n; ++j) {
+		lp.lb[j] = mps_bound(lb[j]);
+		lp.ub[j] = mps_bound(ub[j]);
+	}
+	lp.cost = cost;
+
+	int m = types.size();
+	std::vector<ibex::Vector> a(m, ibex::Vector::zeros(n));
+	for(int j = 0; j < n; ++j) {
+		for(std::map<int, double>::const_iterator it = entries[j].begin(); it != entries[j].end(); ++it) {
+			a[it->first][j] = it->second;
+		}
+	}
+
+	for(int i = 0; i < m; ++i) {
+		double l, u;
+		double r = std::isnan(range[i]) ? NAN : std::fabs(range[i]);
+		switch(types[i]) {
+		case 'L':
+			l = std::isnan(r) ? NEG_INFINITY : rhs[i]-r;
+			u = rhs[i];
+			break;
+		case 'G':
+			l = rhs[i];
+			u = std::isnan(r) ? POS_INFINITY : rhs[i]+r;
+			break;
+		case 'E':
+			l = u = rhs[i];
+			if(!std::isnan(r)) {
+				if(range[i] > 0) u = rhs[i]+r;
+				else l = rhs[i]-r;
+			}
+			break;
+		default:
+			return false;
+		}
+		lp.add_row(mps_bound(l), a[i], mps_bound(u));
+	}
+	return true;
+}
+
+void write_term(std::ostream& os, double v, int j, bool& first) {
+	if(v == 0) return;
+	if(v < 0) os << " - " << -v;
+	else if(!first) os << " + " << v;
+	else os << " " << v;
+	os << " x" << j;
+	first = false;
+}
+
+} /* end anonymous namespace */
+
+namespace ibex {
+
+LPSolver::LPSolver(int nb_vars, LPSolver::Mode mode, double tolerance,
+        double timeout, int max_iter)
+{
+    assert(nb_vars > 0);
+    init(mode, tolerance, timeout, max_iter);
+
+    reset(nb_vars);
+}
+
+LPSolver::LPSolver(std::string filename) {
+    init(LPSolver::Mode::NotCertified, LPSolver::default_tolerance, LPSolver::default_timeout, LPSolver::default_max_iter);
+    bool result = read_mps(filename, *mysimplex);
+    if(!result) {
+        std::string msg = "LPSolver: file " + filename + " could not be read.";
+        ibex_error(msg.c_str());
+    }
+    ivec_bounds_ = IntervalVector(nb_vars());
+    for(int i = 0; i < ivec_bounds_.size(); ++i) {
+        ivec_bounds_[i] = Interval(mysimplex->lb[i], mysimplex->ub[i]);
+    }
+}
+
+LPSolver::~LPSolver() {
+    delete mysimplex;
+}
+
+void LPSolver::init(LPSolver::Mode mode, double tolerance, double timeout, int max_iter) {
+    mysimplex = new DenseSimplex();
+    mode_ = mode;
+    mysimplex->tolerance = tolerance;
+    mysimplex->timeout = timeout;
+    mysimplex->max_iter = max_iter;
+}
+
+int LPSolver::add_constraint(double lhs, const Vector& row, double rhs) {
+    assert(row.size() == nb_vars());
+    assert(std::isfinite(lhs) && std::isfinite(rhs));
+    assert(isfinite(row));
+
+    has_changed = true;
+    rows_changed_ = true;
+    mysimplex->add_row(lhs, row, rhs);
+    return nb_rows()-1;
+}
+
+int LPSolver::add_constraint(const Vector& row, CmpOp op, double rhs) {
+    assert(row.size() == nb_vars());
+    assert(isfinite(row));
+    assert(std::isfinite(rhs));
+
+    has_changed = true;
+    rows_changed_ = true;
+    switch(op) {
+    case LT:
+    case LEQ:
+        mysimplex->add_row(NEG_INFINITY, row, rhs);
+        break;
+    case GT:
+    case GEQ:
+        mysimplex->add_row(rhs, row, POS_INFINITY);
+        break;
+    case EQ:
+        mysimplex->add_row(rhs, row, rhs);
+        break;
+    }
+    return nb_rows()-1;
+}
+
+void LPSolver::add_constraints(const Vector& lhs, const Matrix& rows, const Vector& rhs) {
+    for(int i = 0; i < lhs.size(); ++i) {
+        add_constraint(lhs[i], rows.row(i), rhs[i]);
+    }
+}
+
+void LPSolver::add_constraints(const Matrix& rows, CmpOp op, const Vector& rhs) {
+    for(int i = 0; i < rhs.size(); ++i) {
+        add_constraint(rows.row(i), op, rhs[i]);
+    }
+}
+
+LPSolver::Status LPSolver::minimize() {
+    invalidate();
+    assert(!ivec_bounds_.is_unbounded());
+
+    DenseSimplex::Result result = mysimplex->solve();
+    status_ = LPSolver::Status::Unknown;
+    switch(result) {
+    case DenseSimplex::OPTIMAL:
+        obj_ = mysimplex->obj;
+        uncertified_primal_ = std2ivec(mysimplex->primal, nb_vars());
+        uncertified_dual_ = std2ivec(mysimplex->dual, nb_rows());
+        has_solution_ = true;
+        if(mode_ == LPSolver::Mode::Certified) {
+            // Neumaier Shcherbina cannot fail
+            neumaier_shcherbina_postprocessing();
+            status_ = LPSolver::Status::OptimalProved;
+        } else {
+            status_ = LPSolver::Status::Optimal;
+        }
+        break;
+    case DenseSimplex::TIMEOUT:
+        status_ = LPSolver::Status::Timeout;
+        break;
+    case DenseSimplex::MAX_ITER:
+        status_ = LPSolver::Status::MaxIter;
+        break;
+    case DenseSimplex::INFEASIBLE:
+        status_ = LPSolver::Status::Infeasible;
+        uncertified_infeasible_dir_ = std2ivec(mysimplex->farkas, nb_rows());
+        has_infeasible_dir_ = true;
+        if(mode_ == LPSolver::Mode::Certified) {
+            bool infeasible_proved = neumaier_shcherbina_infeasibility_test();
+            if(infeasible_proved) {
+                status_ = LPSolver::Status::InfeasibleProved;
+            }
+        }
+        break;
+    case DenseSimplex::UNBOUNDED:
+        status_ = LPSolver::Status::Unbounded;
+        break;
+    }
+    return status_;
+}
+
+void LPSolver::set_cost(const Vector& obj) {
+    assert(obj.size() == nb_vars());
+    assert(isfinite(obj));
+    has_changed = true;
+    for(int i = 0; i < nb_vars(); ++i) {
+        mysimplex->cost[i] = obj[i];
+    }
+}
+
+void LPSolver::set_cost(int index, double value) {
+    assert(index >= 0 && index < nb_vars());
+    assert(std::isfinite(value));
+    has_changed = true;
+    mysimplex->cost[index] = value;
+}
+
+void LPSolver::set_bounds(const IntervalVector& bounds) {
+    assert(bounds.size() == nb_vars());
+    assert(!bounds.is_unbounded());
+
+    has_changed = true;
+    lhs_rhs_changed_ = true;
+    // The bounds have to be changed in 3 places: ivec_bounds_,
+    // in variable bounds, and in bounds constraints.
+    ivec_bounds_ = bounds;
+    const int n = nb_vars();
+    for(int i = 0; i < n; ++i) {
+        mysimplex->lb[i] = bounds[i].lb();
+        mysimplex->ub[i] = bounds[i].ub();
+        if(i < nb_rows()) {
+            mysimplex->lhs[i] = bounds[i].lb();
+            mysimplex->rhs[i] = bounds[i].ub();
+        }
+    }
+}
+
+void LPSolver::set_bounds(int var, const Interval& bounds) {
+    assert(var >= 0 && var < nb_vars());
+    assert(!bounds.is_unbounded());
+    has_changed = true;
+    lhs_rhs_changed_ = true;
+    ivec_bounds_[var] = bounds;
+    mysimplex->lb[var] = bounds.lb();
+    mysimplex->ub[var] = bounds.ub();
+    if(var < nb_rows()) {
+        mysimplex->lhs[var] = bounds.lb();
+        mysimplex->rhs[var] = bounds.ub();
+    }
+}
+
+void LPSolver::set_tolerance(double tolerance) {
+    has_changed = true;
+    mysimplex->tolerance = tolerance;
+}
+
+void LPSolver::set_timeout(double timeout) {
+    has_changed = true;
+    mysimplex->timeout = timeout;
+}
+
+void LPSolver::set_max_iter(int max_iter) {
+    has_changed = true;
+    mysimplex->max_iter = max_iter;
+}
+
+int LPSolver::nb_rows() const {
+    return mysimplex->m;
+}
+
+int LPSolver::nb_vars() const {
+    return mysimplex->n;
+}
+
+double LPSolver::tolerance() const {
+    return mysimplex->tolerance;
+}
+
+int LPSolver::max_iter() const {
+    return mysimplex->max_iter;
+}
+
+double LPSolver::timeout() const {
+    return mysimplex->timeout;
+}
+
+LPSolver::Status LPSolver::status() const {
+    return status_;
+}
+
+Matrix LPSolver::rows() const {
+    Matrix m(nb_rows(), nb_vars());
+    for(int i = 0; i < nb_rows(); ++i) {
+        m.set_row(i, row(i));
+    }
+    return m;
+}
+
+Vector LPSolver::row(int index) const {
+    assert(index >= 0 && index < nb_rows());
+    const int n = nb_vars();
+    Vector v(n);
+    for(int j = 0; j < n; ++j) {
+        v[j] = mysimplex->a[index*n+j];
+    }
+    return v;
+}
+
+Matrix LPSolver::rows_transposed() const {
+    return rows().transpose();
+}
+
+Vector LPSolver::col(int index) const {
+    assert(index >= 0 && index < nb_vars());
+    const int n = nb_vars();
+    Vector v(nb_rows());
+    for(int i = 0; i < nb_rows(); ++i) {
+        v[i] = mysimplex->a[i*n+index];
+    }
+    return v;
+}
+
+Vector LPSolver::lhs() const {
+    return std2ivec(mysimplex->lhs, nb_rows());
+}
+
+double LPSolver::lhs(int index) const {
+    assert(index >= 0 && index < nb_rows());
+    return mysimplex->lhs[index];
+}
+
+Vector LPSolver::rhs() const {
+    return std2ivec(mysimplex->rhs, nb_rows());
+}
+
+double LPSolver::rhs(int index) const {
+    assert(index >= 0 && index < nb_rows());
+    return mysimplex->rhs[index];
+}
+
+IntervalVector LPSolver::lhs_rhs() const {
+    IntervalVector lhs_rhs_vec(nb_rows());
+    for(int i = 0; i < lhs_rhs_vec.size(); ++i) {
+        lhs_rhs_vec[i] = Interval(mysimplex->lhs[i], mysimplex->rhs[i]);
+    }
+    return lhs_rhs_vec;
+}
+
+Interval LPSolver::lhs_rhs(int index) const {
+    assert(index >= 0 && index < nb_rows());
+    return Interval(mysimplex->lhs[index], mysimplex->rhs[index]);
+}
+
+IntervalVector LPSolver::bounds() const {
+    return ivec_bounds_;
+}
+
+Interval LPSolver::bounds(int index) const {
+    assert(index >= 0 && index < nb_vars());
+    return ivec_bounds_[index];
+}
+
+Vector LPSolver::cost() const {
+    return std2ivec(mysimplex->cost, nb_vars());
+}
+
+double LPSolver::cost(int index) const {
+    assert(index >= 0 && index < nb_vars());
+    return mysimplex->cost[index];
+}
+
+Interval LPSolver::minimum() const {
+    if(!has_solution_) {
+        ibex_error("LPSolver: no solution stored. Check solver status with LPSolver::status().");
+    }
+    return obj_;
+}
+
+Vector LPSolver::not_proved_primal_sol() const {
+    if(!has_solution_) {
+        ibex_error("LPSolver: no solution stored. Check solver status with LPSolver::status().");
+    }
+    return uncertified_primal_;
+}
+
+Vector LPSolver::not_proved_dual_sol() const {
+    if(!has_solution_) {
+        ibex_error("LPSolver: no solution stored. Check solver status with LPSolver::status().");
+    }
+    return uncertified_dual_;
+}
+
+bool LPSolver::uncertified_infeasible_dir(Vector& infeasible_dir) const {
+    if(has_infeasible_dir_) {
+        infeasible_dir = uncertified_infeasible_dir_;
+        return true;
+    }
+    return false;
+}
+
+// Write the LP in CPLEX LP format.
+void LPSolver::write_to_file(const std::string& filename) const {
+    std::ofstream f(filename.c_str());
+    if(!f.is_open()) {
+        std::string msg = "LPSolver: cannot write file " + filename;
+        ibex_error(msg.c_str());
+    }
+    f.precision(17);
+    const int n = nb_vars();
+    const DenseSimplex& lp = *mysimplex;
+
+    f << "Minimize" << std::endl << " obj:";
+    bool first = true;
+    for(int j = 0; j < n; ++j) {
+        write_term(f, lp.cost[j], j, first);
+    }
+    if(first) f << " 0 x0";
+    f << std::endl << "Subject To" << std::endl;
+
+    for(int i = 0; i < nb_rows(); ++i) {
+        bool bounded_lhs = lp.lhs[i] > NEG_INFINITY;
+        bool bounded_rhs = lp.rhs[i] < POS_INFINITY;
+        if(!bounded_lhs && !bounded_rhs) continue;
+        f << " c" << i << ":";
+        if(bounded_lhs && bounded_rhs && lp.lhs[i] != lp.rhs[i]) {
+            f << " " << lp.lhs[i] << " <=";
+        }
+        first = true;
+        for(int j = 0; j < n; ++j) {
+            write_term(f, lp.a[i*n+j], j, first);
+        }
+        if(first) f << " 0 x0";
+        if(!bounded_rhs) f << " >= " << lp.lhs[i];
+        else if(bounded_lhs && lp.lhs[i] == lp.rhs[i]) f << " = " << lp.rhs[i];
+        else f << " <= " << lp.rhs[i];
+        f << std::endl;
+    }
+
+    f << "Bounds" << std::endl;
+    for(int j = 0; j < n; ++j) {
+        if(lp.lb[j] == NEG_INFINITY && lp.ub[j] == POS_INFINITY) {
+            f << " x" << j << " free" << std::endl;
+        } else {
+            f << " ";
+            if(lp.lb[j] == NEG_INFINITY) f << "-inf";
+            else f << lp.lb[j];
+            f << " <= x" << j << " <= ";
+            if(lp.ub[j] == POS_INFINITY) f << "+inf";
+            else f << lp.ub[j];
+            f << std::endl;
+        }
+    }
+    f << "End" << std::endl;
+}
+
+// Clear functions
+void LPSolver::set_cost_to_zero() {
+    mysimplex->cost.assign(nb_vars(), 0.0);
+}
+
+void LPSolver::clear_constraints() {
+    rows_changed_ = true;
+    mysimplex->remove_rows(nb_vars());
+}
+
+void LPSolver::clear_bounds() {
+    IntervalVector new_bounds(nb_vars(), Interval::ALL_REALS);
+    set_bounds(new_bounds);
+}
+
+void LPSolver::reset(int nb_vars) {
+    assert(nb_vars > 0);
+    invalidate();
+    rows_changed_ = true;
+    mysimplex->reset(nb_vars);
+    Vector row(nb_vars);
+    for(int i = 0; i < nb_vars; ++i) {
+        row = Vector::zeros(nb_vars);
+        row[i] = 1;
+        mysimplex->add_row(NEG_INFINITY, row, POS_INFINITY);
+    }
+    ivec_bounds_ = IntervalVector(nb_vars, Interval::ALL_REALS);
+}
+
+} /* end namespace ibex */
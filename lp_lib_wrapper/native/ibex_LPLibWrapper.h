@@ -0,0 +1,15 @@
+#ifndef _IBEX_LPLIBWRAPPER_H_
+#define _IBEX_LPLIBWRAPPER_H_
+
+namespace ibex {
+
+/*
+ * Dense bounded-variable dual simplex (see ibex_LPLibWrapper.cpp).
+ */
+class DenseSimplex;
+
+}
+
+#define IBEX_LPSOLVER_WRAPPER_ATTRIBUTES DenseSimplex *mysimplex
+
+#endif /* _IBEX_LPLIBWRAPPER_H_ */
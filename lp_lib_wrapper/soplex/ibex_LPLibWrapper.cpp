@@ -62,6 +62,56 @@ soplex::LPRowReal::Type cmpop2type(ibex::CmpOp op) {
 
 }
 
+// Make a basis status consistent with the (possibly new) bounds lb/ub
+// of a variable or a row.
+soplex::SPxSolver::VarStatus fit_status(soplex::SPxSolver::VarStatus s, double lb, double ub) {
+    using VarStatus = soplex::SPxSolver::VarStatus;
+    if(s == VarStatus::BASIC) return s;
+    bool has_lb = lb > -soplex::infinity;
+    bool has_ub = ub < soplex::infinity;
+    if(has_lb && has_ub && lb == ub) return VarStatus::FIXED;
+    if(s == VarStatus::ON_UPPER && has_ub) return s;
+    if(s == VarStatus::ON_LOWER && has_lb) return s;
+    if(has_lb) return VarStatus::ON_LOWER;
+    if(has_ub) return VarStatus::ON_UPPER;
+    return VarStatus::ZERO;
+}
+
+// Save the current basis of the solver (if any).
+void save_basis(soplex::SoPlex& lp, std::vector<soplex::SPxSolver::VarStatus>& rows,
+        std::vector<soplex::SPxSolver::VarStatus>& cols) {
+    if(!lp.hasBasis()) {
+        rows.clear();
+        cols.clear();
+        return;
+    }
+    rows.resize(lp.numRowsReal());
+    cols.resize(lp.numColsReal());
+    lp.getBasis(rows.data(), cols.data());
+}
+
+// Load a basis saved by save_basis(...) and forget it.
+//
+// The saved basis is only loaded if the constraints have the same layout
+// (typically: same linearization, another box). Otherwise, the solver keeps
+// its current basis.
+void restore_basis(soplex::SoPlex& lp, std::vector<soplex::SPxSolver::VarStatus>& rows,
+        std::vector<soplex::SPxSolver::VarStatus>& cols) {
+    if(rows.empty()) return;
+
+    if((int) rows.size() == lp.numRowsReal() && (int) cols.size() == lp.numColsReal()) {
+        for(int i = 0; i < (int) rows.size(); ++i) {
+            rows[i] = fit_status(rows[i], lp.lhsReal(i), lp.rhsReal(i));
+        }
+        for(int j = 0; j < (int) cols.size(); ++j) {
+            cols[j] = fit_status(cols[j], lp.lowerReal(j), lp.upperReal(j));
+        }
+        lp.setBasis(rows.data(), cols.data());
+    }
+    rows.clear();
+    cols.clear();
+}
+
 bool isfinite(const ibex::Vector& v) {
     for(int i = 0; i < v.size(); ++i) {
         if(!std::isfinite(v[i])) {
@@ -156,6 +206,7 @@ int LPSolver::add_constraint(double lhs, const Vector& row, double rhs) {
     assert(isfinite(row));
 
     has_changed = true;
+    rows_changed_ = true;
     mysoplex->addRowReal(LPRowReal(lhs, ivec2dsvec(row), rhs));
     return nb_rows()-1;
 }
@@ -166,6 +217,7 @@ int LPSolver::add_constraint(const Vector& row, CmpOp op, double rhs) {
     assert(std::isfinite(rhs));
 
     has_changed = true;
+    rows_changed_ = true;
     using Type = soplex::LPRowReal::Type;
     Type type = cmpop2type(op);
     DSVectorReal dsrow = ivec2dsvec(row);
@@ -197,6 +249,7 @@ LPSolver::Status LPSolver::minimize() {
     invalidate();
     assert(!ivec_bounds_.is_unbounded());
 
+    restore_basis(*mysoplex, warm_rows, warm_cols);
     mysoplex->solve();
     mysoplex->ignoreUnscaledViolations();
     SPxSolver::Status soplex_status = mysoplex->status();
@@ -276,6 +329,7 @@ void LPSolver::set_bounds(const IntervalVector& bounds) {
     assert(!bounds.is_unbounded());
 
     has_changed = true;
+    lhs_rhs_changed_ = true;
     // The bounds have to be changed in 3 places: ivec_bounds_,
     // in soplex variable bounds, and in bounds constraints.
     ivec_bounds_ = bounds;
@@ -290,6 +344,7 @@ void LPSolver::set_bounds(int var, const Interval& bounds) {
     assert(var >= 0 && var < nb_vars());
     assert(!bounds.is_unbounded());
     has_changed = true;
+    lhs_rhs_changed_ = true;
     ivec_bounds_[var] = bounds;
     mysoplex->changeBoundsReal(var, bounds.lb(), bounds.ub());
     mysoplex->changeRangeReal(var, bounds.lb(), bounds.ub());
@@ -455,6 +510,8 @@ void LPSolver::set_cost_to_zero() {
 }
 
 void LPSolver::clear_constraints() {
+    rows_changed_ = true;
+    save_basis(*mysoplex, warm_rows, warm_cols);
     mysoplex->removeRowRangeReal(nb_vars(), nb_rows()-1);
 }
 
@@ -466,6 +523,9 @@ void LPSolver::clear_bounds() {
 void LPSolver::reset(int nb_vars) {
     assert(nb_vars > 0);
     invalidate();
+    rows_changed_ = true;
+    warm_rows.clear();
+    warm_cols.clear();
     mysoplex->clearLPReal();
 
     // The default sense of optimization in soplex is Maximize,
@@ -12,6 +12,14 @@
 	#include "soplex.h"
 #endif
 
-#define IBEX_LPSOLVER_WRAPPER_ATTRIBUTES soplex::SoPlex *mysoplex
+#include <vector>
+
+/*
+ * warm_rows/warm_cols: basis saved by clear_constraints(), used to
+ * warm start the next call to minimize() (see LPSolver::clear_constraints()).
+ */
+#define IBEX_LPSOLVER_WRAPPER_ATTRIBUTES soplex::SoPlex *mysoplex; \
+                                         std::vector<soplex::SPxSolver::VarStatus> warm_rows; \
+                                         std::vector<soplex::SPxSolver::VarStatus> warm_cols
 
 #endif /* _IBEX_LPLIBWRAPPER_H_ */
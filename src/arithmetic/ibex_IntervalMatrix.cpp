@@ -12,6 +12,7 @@
 #include "ibex_IntervalMatrix.h"
 #include "ibex_Agenda.h"
 #include "ibex_TemplateMatrix.h"
+#include <utility>
 
 namespace ibex {
 
@@ -83,6 +84,12 @@ IntervalMatrix::IntervalMatrix(const Matrix& m) : _nb_rows(m.nb_rows()), _nb_col
 	}
 }
 
+IntervalMatrix::IntervalMatrix(IntervalMatrix&& m) noexcept : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols), M(m.M) {
+	m._nb_rows=0;
+	m._nb_cols=0;
+	m.M=NULL;
+}
+
 IntervalMatrix::~IntervalMatrix() {
 	if (M!=NULL) delete[] M;
 }
@@ -93,6 +100,17 @@ IntervalMatrix& IntervalMatrix::operator=(const IntervalMatrix& x) {
 	return _assignM(*this,x);
 }
 
+IntervalMatrix& IntervalMatrix::operator=(IntervalMatrix&& x) {
+	if (_nb_rows!=x._nb_rows) {
+		// the rows are reallocated anyway: take the storage of x
+		std::swap(_nb_rows,x._nb_rows);
+		std::swap(_nb_cols,x._nb_cols);
+		std::swap(M,x.M);
+		return *this;
+	} else
+		return *this=(const IntervalMatrix&) x;
+}
+
 IntervalMatrix& IntervalMatrix::operator&=(const IntervalMatrix& m) {
 	assert(nb_rows()==m.nb_rows());
 	assert(nb_cols()==m.nb_cols());
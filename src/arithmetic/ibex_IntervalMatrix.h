@@ -44,6 +44,13 @@ public:
 	 */
 	IntervalMatrix(const IntervalMatrix& m);
 
+	/**
+	 * \brief Create a matrix from \a m by moving its storage.
+	 *
+	 * \a m is left uninitialized (0 rows).
+	 */
+	IntervalMatrix(IntervalMatrix&& m) noexcept;
+
 	/**
 	 * \brief Create a degenerated interval matrix.
 	 */
@@ -89,6 +96,15 @@ public:
 	 */
 	IntervalMatrix& operator=(const IntervalMatrix& x);
 
+	/**
+	 * \brief Set *this to m, by moving.
+	 *
+	 * The storage of \a x is taken only when the number of rows
+	 * differ. Otherwise, \a x is copied, so that references to
+	 * the rows of *this remain valid.
+	 */
+	IntervalMatrix& operator=(IntervalMatrix&& x);
+
 	/**
 	 * \brief Set *this to its intersection with x
 	 *
@@ -789,39 +805,57 @@ inline IntervalMatrix operator-(const IntervalMatrix& m) {
 }
 
 inline IntervalMatrix operator+(const IntervalMatrix& m1, const Matrix& m2) {
-	return IntervalMatrix(m1)+=m2;
+	IntervalMatrix res(m1);
+	res+=m2;
+	return res;
 }
 
 inline IntervalMatrix operator+(const Matrix& m1, const IntervalMatrix& m2) {
-	return IntervalMatrix(m1)+=m2;
+	IntervalMatrix res(m1);
+	res+=m2;
+	return res;
 }
 
 inline IntervalMatrix operator+(const IntervalMatrix& m1, const IntervalMatrix& m2) {
-	return IntervalMatrix(m1)+=m2;
+	IntervalMatrix res(m1);
+	res+=m2;
+	return res;
 }
 
 inline IntervalMatrix operator-(const IntervalMatrix& m1, const Matrix& m2) {
-	return IntervalMatrix(m1)-=m2;
+	IntervalMatrix res(m1);
+	res-=m2;
+	return res;
 }
 
 inline IntervalMatrix operator-(const Matrix& m1, const IntervalMatrix& m2) {
-	return IntervalMatrix(m1)-=m2;
+	IntervalMatrix res(m1);
+	res-=m2;
+	return res;
 }
 
 inline IntervalMatrix operator-(const IntervalMatrix& m1, const IntervalMatrix& m2) {
-	return IntervalMatrix(m1)-=m2;
+	IntervalMatrix res(m1);
+	res-=m2;
+	return res;
 }
 
 inline IntervalMatrix operator*(double x, const IntervalMatrix& m) {
-	return IntervalMatrix(m)*=x;
+	IntervalMatrix res(m);
+	res*=x;
+	return res;
 }
 
 inline IntervalMatrix operator*(const Interval& x, const Matrix& m) {
-	return IntervalMatrix(m)*=x;
+	IntervalMatrix res(m);
+	res*=x;
+	return res;
 }
 
 inline IntervalMatrix operator*(const Interval& x, const IntervalMatrix& m) {
-	return IntervalMatrix(m)*=x;
+	IntervalMatrix res(m);
+	res*=x;
+	return res;
 }
 
 inline IntervalMatrix outer_product(const Vector& v1, const IntervalVector& v2) {
@@ -37,6 +37,11 @@ IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(new Interv
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
+IntervalVector::IntervalVector(IntervalVector&& x) noexcept : n(x.n), vec(x.vec) {
+	x.n=0;
+	x.vec=NULL;
+}
+
 IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Interval[n1]) {
 	if (bounds==0) // probably, the user called IntervalVector(n,0) and 0 is interpreted as NULL!
 		for (int i=0; i<n1; i++)
@@ -345,6 +350,8 @@ IntervalVector  IntervalVector::subvector(int start_index, int end_index) const
 void            IntervalVector::put(int start_index, const IntervalVector& x)     { _put(*this, start_index, x); }
 IntervalVector& IntervalVector::operator=(const IntervalVector& x)                { resize(x.size()); // see issue #10
                                                                                     return _assignV(*this,x); }
+IntervalVector& IntervalVector::operator=(IntervalVector&& x)                     { if (n!=x.n) { std::swap(n,x.n); std::swap(vec,x.vec); return *this; }
+                                                                                    else return _assignV(*this,x); }
 bool            IntervalVector::operator==(const IntervalVector& x) const         { return _equalsV(*this,x); }
 Vector          IntervalVector::lb() const                                        { return _lb(*this); }
 Vector          IntervalVector::ub() const                                        { return _ub(*this); }
@@ -26,6 +26,7 @@
 namespace ibex {
 
 class IntervalMatrix; // declared only for friendship
+class Cell;           // declared only for friendship
 
 /**
  * \ingroup arithmetic
@@ -82,6 +83,13 @@ public:
 	 */
 	IntervalVector(const IntervalVector& x);
 
+	/**
+	 * \brief Create a vector from \a x by moving its storage.
+	 *
+	 * \a x is left uninitialized (size 0).
+	 */
+	IntervalVector(IntervalVector&& x) noexcept;
+
 	/**
 	 * \brief Create the IntervalVector [bounds[0][0],bounds[0][1]]x...x[bounds[n-1][0],bounds[n-1][1]]
 	 *
@@ -221,6 +229,15 @@ public:
 	 */
 	IntervalVector& operator=(const IntervalVector& x);
 
+	/**
+	 * \brief Assign this IntervalVector to x, by moving.
+	 *
+	 * The storage of \a x is taken only when the dimensions
+	 * differ (i.e., when a copy would reallocate anyway), so that
+	 * references to the components of *this remain valid otherwise.
+	 */
+	IntervalVector& operator=(IntervalVector&& x);
+
 	/**
 	 * \brief Set *this to its intersection with x
 	 *
@@ -634,6 +651,7 @@ public:
 
 private:
 	friend class IntervalMatrix;
+	friend class Cell; // recycles the storage of its box
 
 	int n;             // dimension (size of vec)
 	Interval *vec;	   // vector of elements
@@ -882,11 +900,15 @@ inline void IntervalVector::clear() {
 }
 
 inline IntervalVector IntervalVector::operator&(const IntervalVector& x) const {
-	return IntervalVector(*this) &= x;
+	IntervalVector res(*this);
+	res &= x;
+	return res;
 }
 
 inline IntervalVector IntervalVector::operator|(const IntervalVector& x) const {
-	return IntervalVector(*this) |= x;
+	IntervalVector res(*this);
+	res |= x;
+	return res;
 }
 
 inline bool IntervalVector::operator!=(const IntervalVector& x) const {
@@ -955,39 +977,57 @@ inline IntervalVector operator-(const IntervalVector& x) {
 }
 
 inline IntervalVector operator+(const IntervalVector& m1, const Vector& m2) {
-	return IntervalVector(m1)+=m2;
+	IntervalVector res(m1);
+	res+=m2;
+	return res;
 }
 
 inline IntervalVector operator+(const Vector& m1, const IntervalVector& m2) {
-	return IntervalVector(m1)+=m2;
+	IntervalVector res(m1);
+	res+=m2;
+	return res;
 }
 
 inline IntervalVector operator+(const IntervalVector& m1, const IntervalVector& m2) {
-	return IntervalVector(m1)+=m2;
+	IntervalVector res(m1);
+	res+=m2;
+	return res;
 }
 
 inline IntervalVector operator-(const IntervalVector& m1, const Vector& m2) {
-	return IntervalVector(m1)-=m2;
+	IntervalVector res(m1);
+	res-=m2;
+	return res;
 }
 
 inline IntervalVector operator-(const Vector& m1, const IntervalVector& m2) {
-	return IntervalVector(m1)-=m2;
+	IntervalVector res(m1);
+	res-=m2;
+	return res;
 }
 
 inline IntervalVector operator-(const IntervalVector& m1, const IntervalVector& m2) {
-	return IntervalVector(m1)-=m2;
+	IntervalVector res(m1);
+	res-=m2;
+	return res;
 }
 
 inline IntervalVector operator*(double x, const IntervalVector& v) {
-	return IntervalVector(v)*=x;
+	IntervalVector res(v);
+	res*=x;
+	return res;
 }
 
 inline IntervalVector operator*(const Interval& x, const Vector& v) {
-	return IntervalVector(v)*=x;
+	IntervalVector res(v);
+	res*=x;
+	return res;
 }
 
 inline IntervalVector operator*(const Interval& x, const IntervalVector& v) {
-	return IntervalVector(v)*=x;
+	IntervalVector res(v);
+	res*=x;
+	return res;
 }
 
 inline Interval operator*(const Vector& v1, const IntervalVector& v2) {
@@ -12,6 +12,7 @@
 #include "ibex_Matrix.h"
 #include "ibex_Agenda.h"
 #include "ibex_TemplateMatrix.h"
+#include <utility>
 
 namespace ibex {
 
@@ -75,6 +76,12 @@ Matrix::Matrix(const Matrix& m) : _nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()){
 	}
 }
 
+Matrix::Matrix(Matrix&& m) noexcept : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols), M(m.M) {
+	m._nb_rows=0;
+	m._nb_cols=0;
+	m.M=NULL;
+}
+
 Matrix::~Matrix() {
 	delete[] M;
 }
@@ -104,6 +111,17 @@ Matrix& Matrix::operator=(const Matrix& x) {
 	return _assignM(*this,x);
 }
 
+Matrix& Matrix::operator=(Matrix&& x) {
+	if (_nb_rows!=x._nb_rows) {
+		// the rows are reallocated anyway: take the storage of x
+		std::swap(_nb_rows,x._nb_rows);
+		std::swap(_nb_cols,x._nb_cols);
+		std::swap(M,x.M);
+		return *this;
+	} else
+		return *this=(const Matrix&) x;
+}
+
 bool Matrix::operator==(const Matrix& m) const {
 	return _equalsM(*this,m);
 }
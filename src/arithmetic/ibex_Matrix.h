@@ -42,6 +42,13 @@ public:
 	 */
 	Matrix(const Matrix& m);
 
+	/**
+	 * \brief Create a matrix from \a m by moving its storage.
+	 *
+	 * \a m is left uninitialized (0 rows).
+	 */
+	Matrix(Matrix&& m) noexcept;
+
 	/**
 	 * \brief Create a matrix from an array of doubles.
 	 *
@@ -73,6 +80,15 @@ public:
 	 */
 	Matrix& operator=(const Matrix& x);
 
+	/**
+	 * \brief Set *this to m, by moving.
+	 *
+	 * The storage of \a x is taken only when the number of rows
+	 * differ. Otherwise, \a x is copied, so that references to
+	 * the rows of *this remain valid.
+	 */
+	Matrix& operator=(Matrix&& x);
+
 	/**
 	 * \brief True if the entries of (*this) coincide with m.
 	 *
@@ -390,7 +406,9 @@ inline Matrix& Matrix::operator*=(const Matrix& m) {
 }
 
 inline Matrix operator+(const Matrix& m1, const Matrix& m2) {
-	return Matrix(m1)+=m2;
+	Matrix res(m1);
+	res+=m2;
+	return res;
 }
 
 inline Matrix operator-(const Matrix& m) {
@@ -398,11 +416,15 @@ inline Matrix operator-(const Matrix& m) {
 }
 
 inline Matrix operator-(const Matrix& m1, const Matrix& m2) {
-	return Matrix(m1)-=m2;
+	Matrix res(m1);
+	res-=m2;
+	return res;
 }
 
 inline Matrix operator*(double x, const Matrix& m) {
-	return Matrix(m)*=x;
+	Matrix res(m);
+	res*=x;
+	return res;
 }
 
 inline Matrix operator*(const Matrix& m1, const Matrix& m2) {
@@ -0,0 +1,189 @@
+/* ============================================================================
+ * I B E X - Interval matrix with packed bounds
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_PackedIntervalMatrix.h"
+
+#include <cfenv>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Set the rounding mode upward during the lifetime of the object.
+ * The mode expected by the interval library is restored afterwards,
+ * so that no Interval operation must be performed in the meantime.
+ *
+ * Lower bounds are obtained with upward rounding by computing
+ * the opposite of the lower bound: lb(x*y) = -((-x)*y).
+ */
+class RoundUpward {
+public:
+	RoundUpward() : mode(fegetround()) {
+		fesetround(FE_UPWARD);
+	}
+
+	~RoundUpward() {
+		fesetround(mode);
+	}
+
+private:
+	int mode;
+};
+
+/*
+ * Number of rows of A (in C*A) processed at a time, so that
+ * they stay in cache while all the rows of C are scanned.
+ */
+const int block_size=64;
+
+/*
+ * Accumulate the bounds of al[j..j1-1]*xl[j..j1-1] in up (upper bound) and
+ * nl (opposite of the lower bound).
+ */
+void dot_range(const double* al, const double* ah, const double* xl, const double* xh, int j, int j1, double& up, double& nl) {
+	for (; j<j1; j++) {
+		double p1=al[j]*xl[j];
+		double p2=al[j]*xh[j];
+		double p3=ah[j]*xl[j];
+		double p4=ah[j]*xh[j];
+		up += std::max(std::max(p1,p2),std::max(p3,p4));
+
+		double q1=(-al[j])*xl[j];
+		double q2=(-al[j])*xh[j];
+		double q3=(-ah[j])*xl[j];
+		double q4=(-ah[j])*xh[j];
+		nl += std::max(std::max(q1,q2),std::max(q3,q4));
+	}
+}
+
+} // end anonymous namespace
+
+PackedIntervalMatrix::PackedIntervalMatrix(int nb_rows, int nb_cols) : _nb_rows(nb_rows), _nb_cols(nb_cols) {
+	assert(nb_rows>0);
+	assert(nb_cols>0);
+	_lb = new double[nb_rows*nb_cols];
+	_ub = new double[nb_rows*nb_cols];
+}
+
+PackedIntervalMatrix::PackedIntervalMatrix(const IntervalMatrix& M) : _nb_rows(M.nb_rows()), _nb_cols(M.nb_cols()) {
+	_lb = new double[_nb_rows*_nb_cols];
+	_ub = new double[_nb_rows*_nb_cols];
+	for (int i=0; i<_nb_rows; i++)
+		for (int j=0; j<_nb_cols; j++)
+			set(i,j,M[i][j]);
+}
+
+PackedIntervalMatrix::PackedIntervalMatrix(const IntervalVector& v) : _nb_rows(v.size()), _nb_cols(1) {
+	_lb = new double[_nb_rows];
+	_ub = new double[_nb_rows];
+	for (int i=0; i<_nb_rows; i++)
+		set(i,0,v[i]);
+}
+
+PackedIntervalMatrix::~PackedIntervalMatrix() {
+	delete[] _lb;
+	delete[] _ub;
+}
+
+void PackedIntervalMatrix::get(IntervalMatrix& M) const {
+	assert(M.nb_rows()==_nb_rows && M.nb_cols()==_nb_cols);
+	for (int i=0; i<_nb_rows; i++)
+		for (int j=0; j<_nb_cols; j++)
+			M[i][j]=get(i,j);
+}
+
+void PackedIntervalMatrix::get(IntervalVector& v) const {
+	assert(_nb_cols==1 && v.size()==_nb_rows);
+	for (int i=0; i<_nb_rows; i++)
+		v[i]=get(i,0);
+}
+
+bool PackedIntervalMatrix::is_bounded() const {
+	for (int k=0; k<_nb_rows*_nb_cols; k++)
+		if (!(_lb[k]>NEG_INFINITY && _ub[k]<POS_INFINITY && _lb[k]<=_ub[k])) return false;
+	return true;
+}
+
+void mul(const Matrix& C, const PackedIntervalMatrix& A, PackedIntervalMatrix& R) {
+	int m=C.nb_rows();
+	int p=C.nb_cols();
+	int n=A.nb_cols();
+	assert(A.nb_rows()==p);
+	assert(R.nb_rows()==m && R.nb_cols()==n);
+	assert(&R!=&A);
+
+	// R.lb(i) holds the opposite of the lower bounds
+	// until the end of the computation
+	for (int i=0; i<m; i++) {
+		fill(R.lb(i), R.lb(i)+n, 0.0);
+		fill(R.ub(i), R.ub(i)+n, 0.0);
+	}
+
+	{
+		RoundUpward round;
+
+		for (int k0=0; k0<p; k0+=block_size) {
+			int k1=std::min(k0+block_size,p);
+			for (int i=0; i<m; i++) {
+				const Vector& c=C[i];
+				double* nl=R.lb(i);
+				double* up=R.ub(i);
+				for (int k=k0; k<k1; k++) {
+					double ck=c[k];
+					if (ck==0) continue;
+					// with c>=0: c*[l,h]=[c*l,c*h], otherwise [c*h,c*l]
+					const double* h= ck>0 ? A.ub(k) : A.lb(k);
+					const double* l= ck>0 ? A.lb(k) : A.ub(k);
+					double nck=-ck;
+					for (int j=0; j<n; j++) {
+						up[j] += ck*h[j];
+						nl[j] += nck*l[j];
+					}
+				}
+			}
+		}
+	}
+
+	for (int i=0; i<m; i++) {
+		double* l=R.lb(i);
+		for (int j=0; j<n; j++) l[j]=-l[j];
+	}
+}
+
+Interval dot(const PackedIntervalMatrix& A, int i, const PackedIntervalMatrix& x, int skip) {
+	int n=A.nb_cols();
+	assert(x.nb_rows()==n && x.nb_cols()==1);
+
+	const double* al=A.lb(i);
+	const double* ah=A.ub(i);
+	const double* xl=x.lb(0);
+	const double* xh=x.ub(0);
+
+	double up=0;
+	double nl=0;
+
+	{
+		RoundUpward round;
+
+		if (skip<0 || skip>=n)
+			dot_range(al,ah,xl,xh,0,n,up,nl);
+		else {
+			dot_range(al,ah,xl,xh,0,skip,up,nl);
+			dot_range(al,ah,xl,xh,skip+1,n,up,nl);
+		}
+	}
+
+	return Interval(-nl,up);
+}
+
+} // namespace ibex
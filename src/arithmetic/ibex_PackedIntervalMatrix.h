@@ -0,0 +1,182 @@
+/* ============================================================================
+ * I B E X - Interval matrix with packed bounds
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_PACKED_INTERVAL_MATRIX_H__
+#define __IBEX_PACKED_INTERVAL_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ * \brief Interval matrix with packed bounds.
+ *
+ * The lower and upper bounds of the entries are stored in two
+ * contiguous row-major arrays of doubles (instead of an array of
+ * rows of #ibex::Interval). This is the layout expected by the dense
+ * kernels below, which run with the rounding mode set upward once
+ * for all and whose inner loops can be vectorized by the compiler.
+ *
+ * An interval vector is packed as a column (nx1 matrix).
+ *
+ * The kernels require a bounded matrix (see #is_bounded()). Otherwise,
+ * the usual #ibex::IntervalMatrix operations must be used instead.
+ */
+class PackedIntervalMatrix {
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix (uninitialized).
+	 */
+	PackedIntervalMatrix(int nb_rows, int nb_cols);
+
+	/**
+	 * \brief Create a packed copy of \a M.
+	 */
+	explicit PackedIntervalMatrix(const IntervalMatrix& M);
+
+	/**
+	 * \brief Create a packed copy of \a v (as a column).
+	 */
+	explicit PackedIntervalMatrix(const IntervalVector& v);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PackedIntervalMatrix();
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Lower bounds of the ith row.
+	 */
+	double* lb(int i);
+
+	/**
+	 * \brief Lower bounds of the ith row (const version).
+	 */
+	const double* lb(int i) const;
+
+	/**
+	 * \brief Upper bounds of the ith row.
+	 */
+	double* ub(int i);
+
+	/**
+	 * \brief Upper bounds of the ith row (const version).
+	 */
+	const double* ub(int i) const;
+
+	/**
+	 * \brief Set the entry (i,j) to \a x.
+	 */
+	void set(int i, int j, const Interval& x);
+
+	/**
+	 * \brief Return the entry (i,j).
+	 */
+	Interval get(int i, int j) const;
+
+	/**
+	 * \brief Copy this into \a M.
+	 *
+	 * \pre \a M has the same dimensions.
+	 */
+	void get(IntervalMatrix& M) const;
+
+	/**
+	 * \brief Copy this (a column) into \a v.
+	 *
+	 * \pre this is a nx1 matrix, where n is the size of \a v.
+	 */
+	void get(IntervalVector& v) const;
+
+	/**
+	 * \brief True iff no entry is empty or unbounded.
+	 *
+	 * \note Complexity: O(nb_rows*nb_cols).
+	 */
+	bool is_bounded() const;
+
+private:
+	PackedIntervalMatrix(const PackedIntervalMatrix&);
+
+	const int _nb_rows;
+	const int _nb_cols;
+	double* _lb;
+	double* _ub;
+};
+
+/**
+ * \brief Product C*A with packed bounds.
+ *
+ * Set \a R to an enclosure of { C*A' : A' in A }.
+ * The result is the same as C*A (up to rounding of the sums).
+ *
+ * \pre A is bounded, R has the dimensions of C*A and is not A.
+ */
+void mul(const Matrix& C, const PackedIntervalMatrix& A, PackedIntervalMatrix& R);
+
+/**
+ * \brief Dot product of a row with a column, with packed bounds.
+ *
+ * Return an enclosure of the sum over all j (except j=skip) of A[i][j]*x[j].
+ *
+ * \param skip - a column to be skipped (-1 for none).
+ * \pre A and x are bounded and x is a (A.nb_cols() x 1) matrix.
+ */
+Interval dot(const PackedIntervalMatrix& A, int i, const PackedIntervalMatrix& x, int skip=-1);
+
+/*================================== inline implementations ========================================*/
+
+inline int PackedIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int PackedIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline double* PackedIntervalMatrix::lb(int i) {
+	return _lb+i*_nb_cols;
+}
+
+inline const double* PackedIntervalMatrix::lb(int i) const {
+	return _lb+i*_nb_cols;
+}
+
+inline double* PackedIntervalMatrix::ub(int i) {
+	return _ub+i*_nb_cols;
+}
+
+inline const double* PackedIntervalMatrix::ub(int i) const {
+	return _ub+i*_nb_cols;
+}
+
+inline void PackedIntervalMatrix::set(int i, int j, const Interval& x) {
+	// an empty interval is stored as [+oo,-oo]
+	lb(i)[j]=x.is_empty() ? POS_INFINITY : x.lb();
+	ub(i)[j]=x.is_empty() ? NEG_INFINITY : x.ub();
+}
+
+inline Interval PackedIntervalMatrix::get(int i, int j) const {
+	return Interval(lb(i)[j],ub(i)[j]);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_PACKED_INTERVAL_MATRIX_H__
@@ -0,0 +1,121 @@
+/* ============================================================================
+ * I B E X - Sparse interval matrix
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_rows, int nb_cols, const vector<vector<int> >& pattern) :
+		_nb_rows(nb_rows), _nb_cols(nb_cols), empty(false) {
+	assert(nb_rows>0 && nb_cols>0);
+	assert((int) pattern.size()==nb_rows);
+	init(pattern);
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const IntervalMatrix& M) :
+		_nb_rows(M.nb_rows()), _nb_cols(M.nb_cols()), empty(M.is_empty()) {
+	vector<vector<int> > pattern(_nb_rows);
+	for (int i=0; i<_nb_rows; i++)
+		for (int j=0; j<_nb_cols; j++)
+			if (M[i][j]!=Interval::zero()) pattern[i].push_back(j);
+	init(pattern);
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=start[i]; k<start[i+1]; k++)
+			val[k]=M[i][index[k]];
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const SparseIntervalMatrix& M) :
+		_nb_rows(M._nb_rows), _nb_cols(M._nb_cols), empty(M.empty) {
+	int nnz=M.nb_entries();
+	start = new int[_nb_rows+1];
+	index = new int[nnz];
+	val = new Interval[nnz];
+	for (int i=0; i<=_nb_rows; i++) start[i]=M.start[i];
+	for (int k=0; k<nnz; k++) {
+		index[k]=M.index[k];
+		val[k]=M.val[k];
+	}
+}
+
+void SparseIntervalMatrix::init(const vector<vector<int> >& pattern) {
+	start = new int[_nb_rows+1];
+	start[0]=0;
+	for (int i=0; i<_nb_rows; i++)
+		start[i+1]=start[i]+pattern[i].size();
+
+	index = new int[start[_nb_rows]];
+	val = new Interval[start[_nb_rows]];
+
+	for (int i=0; i<_nb_rows; i++) {
+		copy(pattern[i].begin(), pattern[i].end(), index+start[i]);
+		sort(index+start[i], index+start[i+1]);
+		for (int k=start[i]; k<start[i+1]; k++) {
+			assert(index[k]>=0 && index[k]<_nb_cols);
+			assert(k==start[i] || index[k]>index[k-1]);
+			val[k]=Interval::zero();
+		}
+	}
+}
+
+SparseIntervalMatrix::~SparseIntervalMatrix() {
+	delete[] start;
+	delete[] index;
+	delete[] val;
+}
+
+Interval SparseIntervalMatrix::get(int i, int j) const {
+	int* end=index+start[i+1];
+	int* k=lower_bound(index+start[i], end, j);
+	if (k!=end && *k==j)
+		return val[k-index];
+	else
+		return Interval::zero();
+}
+
+IntervalMatrix SparseIntervalMatrix::dense() const {
+	IntervalMatrix M(_nb_rows, _nb_cols, Interval::zero());
+	if (empty) {
+		M.set_empty();
+		return M;
+	}
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=start[i]; k<start[i+1]; k++)
+			M[i][index[k]]=val[k];
+	return M;
+}
+
+void SparseIntervalMatrix::set_empty() {
+	for (int k=0; k<nb_entries(); k++)
+		val[k]=Interval::empty_set();
+	empty=true;
+}
+
+IntervalVector operator*(const SparseIntervalMatrix& A, const IntervalVector& x) {
+	assert(A.nb_cols()==x.size());
+
+	IntervalVector y(A.nb_rows());
+
+	if (A.is_empty() || x.is_empty()) {
+		y.set_empty();
+		return y;
+	}
+
+	for (int i=0; i<A.nb_rows(); i++) {
+		y[i]=Interval::zero();
+		for (int k=A.row_begin(i); k<A.row_end(i); k++)
+			y[i]+=A.entry(k)*x[A.col(k)];
+	}
+	return y;
+}
+
+} // namespace ibex
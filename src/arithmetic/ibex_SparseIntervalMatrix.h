@@ -0,0 +1,178 @@
+/* ============================================================================
+ * I B E X - Sparse interval matrix
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SPARSE_INTERVAL_MATRIX_H__
+#define __IBEX_SPARSE_INTERVAL_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ * \brief Sparse interval matrix.
+ *
+ * The sparsity pattern (the positions of the entries that may
+ * be nonzero) is fixed at construction. The entries are stored
+ * row by row ("compressed sparse row" format): the entries of the
+ * ith row are the entries k with #row_begin(i) <= k < #row_end(i),
+ * where #col(k) is the column and #entry(k) the value of the kth entry.
+ * The columns of a row are sorted.
+ *
+ * Entries outside the pattern are (exactly) zero.
+ */
+class SparseIntervalMatrix {
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix with a given pattern.
+	 *
+	 * \param pattern - pattern[i] contains the columns of the ith row
+	 *                  (in any order, without duplicates).
+	 *
+	 * All the entries are initialized to [0,0].
+	 */
+	SparseIntervalMatrix(int nb_rows, int nb_cols, const std::vector<std::vector<int> >& pattern);
+
+	/**
+	 * \brief Create a sparse copy of \a M (all the entries different from [0,0] are in the pattern).
+	 */
+	explicit SparseIntervalMatrix(const IntervalMatrix& M);
+
+	/**
+	 * \brief Duplicate a matrix.
+	 */
+	SparseIntervalMatrix(const SparseIntervalMatrix& M);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~SparseIntervalMatrix();
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Number of entries in the pattern.
+	 */
+	int nb_entries() const;
+
+	/**
+	 * \brief First entry of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Past-the-end entry of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column of the kth entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth entry.
+	 */
+	Interval& entry(int k);
+
+	/**
+	 * \brief Value of the kth entry (const version).
+	 */
+	const Interval& entry(int k) const;
+
+	/**
+	 * \brief Return the entry at (i,j) ([0,0] if not in the pattern).
+	 *
+	 * \note Complexity: O(log(nb entries of the ith row)).
+	 */
+	Interval get(int i, int j) const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix dense() const;
+
+	/**
+	 * \brief Set all the entries to the empty interval.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief True iff this matrix is empty.
+	 */
+	bool is_empty() const;
+
+private:
+	void init(const std::vector<std::vector<int> >& pattern);
+
+	const int _nb_rows;
+	const int _nb_cols;
+	int* start;     // start[i]: first entry of the ith row (size nb_rows+1)
+	int* index;     // index[k]: column of the kth entry
+	Interval* val;  // val[k]: value of the kth entry
+	bool empty;
+};
+
+/**
+ * \brief Return A*x.
+ */
+IntervalVector operator*(const SparseIntervalMatrix& A, const IntervalVector& x);
+
+/*================================== inline implementations ========================================*/
+
+inline int SparseIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int SparseIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int SparseIntervalMatrix::nb_entries() const {
+	return start[_nb_rows];
+}
+
+inline int SparseIntervalMatrix::row_begin(int i) const {
+	return start[i];
+}
+
+inline int SparseIntervalMatrix::row_end(int i) const {
+	return start[i+1];
+}
+
+inline int SparseIntervalMatrix::col(int k) const {
+	return index[k];
+}
+
+inline Interval& SparseIntervalMatrix::entry(int k) {
+	empty=false;
+	return val[k];
+}
+
+inline const Interval& SparseIntervalMatrix::entry(int k) const {
+	return val[k];
+}
+
+inline bool SparseIntervalMatrix::is_empty() const {
+	return empty;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SPARSE_INTERVAL_MATRIX_H__
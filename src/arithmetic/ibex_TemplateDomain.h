@@ -105,6 +105,14 @@ public:
 	 */
 	TemplateDomain(const TemplateDomain<D>& d, bool is_reference1=false);
 
+	/**
+	 * \brief Creates a domain by moving.
+	 *
+	 * The internal domain of \a d is taken (or shared, if \a d
+	 * is a reference). \a d becomes a reference to it.
+	 */
+	TemplateDomain(TemplateDomain<D>&& d) noexcept;
+
 	/**
 	 * \brief Creates a domain (by copy) as a vector of other domains.
 	 *
@@ -500,6 +508,11 @@ inline TemplateDomain<D>::TemplateDomain(const TemplateDomain<D>& d, bool is_ref
 	}
 }
 
+template<class D>
+inline TemplateDomain<D>::TemplateDomain(TemplateDomain<D>&& d) noexcept : dim(d.dim), is_reference(d.is_reference), domain(d.domain) {
+	(bool&) d.is_reference = true;
+}
+
 template<class D>
 inline TemplateDomain<D>::TemplateDomain(const Array<const TemplateDomain<D> >& arg, bool row_vec) : dim(Dim::scalar() /* TMP */), is_reference(false), domain(NULL) {
 
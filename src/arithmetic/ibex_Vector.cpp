@@ -12,6 +12,7 @@
 #include <float.h>
 #include <math.h>
 #include "ibex_TemplateVector.h"
+#include <utility>
 
 namespace ibex {
 
@@ -35,6 +36,11 @@ Vector::Vector(const Vector& x) : n(x.n), vec(new double[x.n]) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
+Vector::Vector(Vector&& x) noexcept : n(x.n), vec(x.vec) {
+	x.n=0;
+	x.vec=NULL;
+}
+
 Vector::Vector(int nn, double x[]) : n(nn), vec(new double[nn]) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=x[i];
@@ -99,6 +105,8 @@ Vector  Vector::subvector(int start_index, int end_index) const   { return _subv
 void    Vector::put(int start_index, const Vector& x)             { _put(*this, start_index, x); }
 Vector& Vector::operator=(const Vector& x)                        { resize(x.size()); // see issue #10
                                                                     return _assignV(*this,x); }
+Vector& Vector::operator=(Vector&& x)                             { if (n!=x.n) { std::swap(n,x.n); std::swap(vec,x.vec); return *this; }
+                                                                    else return _assignV(*this,x); }
 Vector abs(const Vector& v)                                       { return _abs(v); }
 bool   Vector::operator==(const Vector& x) const                  { return _equalsV(*this,x); }
 std::ostream&   operator<<(std::ostream& os, const Vector& x)     { return _displayV(os,x); }
@@ -59,6 +59,13 @@ public:
 	 */
 	Vector(const Vector& x);
 
+	/**
+	 * \brief Create a vector from \a x by moving its storage.
+	 *
+	 * \a x is left uninitialized (size 0).
+	 */
+	Vector(Vector&& x) noexcept;
+
 	/**
 	 * \brief Create the Vector [x[0]; ..; x[n]]
 	 *
@@ -118,6 +125,14 @@ public:
 	 */
 	Vector& operator=(const Vector& x);
 
+	/**
+	 * \brief Assign this Vector to x, by moving.
+	 *
+	 * The storage of \a x is taken only when the dimensions
+	 * differ (see #ibex::IntervalVector::operator=(IntervalVector&&)).
+	 */
+	Vector& operator=(Vector&& x);
+
 	/**
 	 * \brief Return true if the components of this Vector match that of \a x.
 	 */
@@ -333,15 +348,21 @@ inline Vector& Vector::operator*=(double x) {
 }
 
 inline Vector operator+(const Vector& m1, const Vector& m2) {
-	return Vector(m1)+=m2;
+	Vector res(m1);
+	res+=m2;
+	return res;
 }
 
 inline Vector operator-(const Vector& m1, const Vector& m2) {
-	return Vector(m1)-=m2;
+	Vector res(m1);
+	res-=m2;
+	return res;
 }
 
 inline Vector operator*(double x, const Vector& v) {
-	return Vector(v)*=x;
+	Vector res(v);
+	res*=x;
+	return res;
 }
 
 inline Vector hadamard_product(const Vector& v1, const Vector& v2) {
@@ -42,6 +42,8 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> timeout(parser, "float", "Timeout (time in seconds). Default value is +oo.", {'t', "timeout"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::ValueFlag<double> eps_x(parser, "float", _eps_x.str(), {"eps-x"});
+	args::ValueFlag<int>    nb_threads(parser, "int", "Number of threads. With more than one thread, cells are "
+			"processed in parallel (the result is then not deterministic). Default value is 1.", {'j',"threads"});
 	args::ValueFlag<int>    simpl_level(parser, "int", "Expression simplification level. Possible values are:\n"
 			"\t\t* 0:\tno simplification at all (fast).\n"
 			"\t\t* 1:\tbasic simplifications (fairly fast). E.g. x+1+1 --> x+2\n"
@@ -59,6 +61,9 @@ int main(int argc, char** argv) {
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexOpt", {"format"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
+	args::ValueFlag<string> profile(parser, "filename", "Profiling report. Statistics on the contractors, the bisector "
+			"and the loup finder (number of calls, time, volume reduction, empty-box rate) are written in this file, "
+			"in JSON format if the name ends with \".json\", in CSV format otherwise.", {"profile"});
 
 	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
 
@@ -235,6 +240,12 @@ int main(int argc, char** argv) {
 			config.set_timeout(timeout.Get());
 		}
 
+		if (nb_threads) {
+			if (!quiet)
+				cout << "  threads:\t\t" << nb_threads.Get() << endl;
+			config.set_nb_threads(nb_threads.Get());
+		}
+
 		// This option prints each better feasible point when it is found
 		if (trace) {
 			if (!quiet)
@@ -254,6 +265,10 @@ int main(int argc, char** argv) {
 			config.set_extended_cov(false);
 		}
 
+		if (profile && !quiet) {
+			cout << "  profile:\t\t" << profile.Get() << endl;
+		}
+
 		if (!quiet) {
 			cout << "*******************************************************" << endl << endl;
 		}
@@ -261,6 +276,10 @@ int main(int argc, char** argv) {
 		// Build the default optimizer
 		Optimizer o(config);
 
+		// This option activates the profiler
+		Profiler profiler;
+		if (profile) o.profiler=&profiler;
+
 		// display solutions with up to 12 decimals
 		cout.precision(12);
 
@@ -295,6 +314,12 @@ int main(int argc, char** argv) {
 				cout << " (old file saved in " << cov_copy << ")\n";
 		}
 
+		if (profile) {
+			profiler.save(profile.Get().c_str());
+			if (!quiet)
+				cout << " profiling report written in " << profile.Get() << "\n";
+		}
+
 		delete sys;
 
 		return 0;
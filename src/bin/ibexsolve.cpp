@@ -47,6 +47,8 @@ int main(int argc, char** argv) {
 			"description of the manifold with boxes in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexSolve", {"format"});
 	args::Flag bfs(parser, "bfs", "Perform breadth-first search (instead of depth-first search, by default)", {"bfs"});
+	args::ValueFlag<unsigned int> bfs_mem(parser, "int", "Maximal number of cells kept in memory in breadth-first search (with --bfs). "
+			"The other cells are stored in a temporary file. Default value is +oo (all cells are kept in memory).", {"bfs-mem"});
 	args::Flag trace(parser, "trace", "Activate trace. \"Solutions\" (output boxes) are displayed as and when they are found.", {"trace"});
 	args::Flag stop_at_first(parser, "stop-a-first", "Stop at first solution/boundary/unknown box found.", {"stop-at-first"});
 	args::ValueFlag<string> boundary_test_arg(parser, "true|full-rank|half-ball|false", "Boundary test strength. Possible values are:\n"
@@ -57,7 +59,12 @@ int main(int argc, char** argv) {
 			{"boundary"});
 	args::Flag sols(parser, "sols", "Display the \"solutions\" (output boxes) on the standard output.", {'s',"sols"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
+	args::ValueFlag<int>    nb_threads(parser, "int", "Number of threads. With more than one thread, the search tree is "
+			"explored in parallel, depth-first in each thread (the order of output boxes is then not deterministic). Default value is 1.", {'j',"threads"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
+	args::ValueFlag<string> profile(parser, "filename", "Profiling report. Statistics on the contractors, the bisector "
+			"(number of calls, time, volume reduction, empty-box rate) are written in this file, in JSON format "
+			"if the name ends with \".json\", in CSV format otherwise.", {"profile"});
 	args::ValueFlag<string> forced_params(parser, "vars","Force some variables to be parameters in the parametric proofs, separated by '+'. Example: --forced-params=x+y",{"forced-params"});
 	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
 
@@ -117,6 +124,12 @@ int main(int argc, char** argv) {
 			if (bfs)
 				cout << "  bfs:\t\t\tON" << endl;
 
+			if (bfs_mem)
+				cout << "  bfs memory:\t\t" << bfs_mem.Get() << " cells" << endl;
+
+			if (nb_threads)
+				cout << "  threads:\t\t" << nb_threads.Get() << endl;
+
 			if (stop_at_first)
 				cout << "  stop at first box found" << endl;
 		}
@@ -162,12 +175,27 @@ int main(int argc, char** argv) {
 			cout << "  output file:\t\t" << output_manifold_file << "\n";
 		}
 
+		if (bfs_mem) {
+			if (bfs_mem.Get()<2) {
+				cerr << "\nError: the memory budget (--bfs-mem) must be at least 2 cells\n";
+				exit(0);
+			}
+			if (!bfs)
+				ibex_warning("--bfs-mem is ignored without --bfs");
+		}
+
+		// the search is depth-first in each thread
+		if (bfs && nb_threads && nb_threads.Get()>1)
+			ibex_warning("--bfs and --bfs-mem are ignored with more than one thread");
+
 		// Build the default solver
 		DefaultSolver s(sys,
 				eps_x_min ? eps_x_min.Get() : DefaultSolver::default_eps_x_min,
 				eps_x_max ? eps_x_max.Get() : DefaultSolver::default_eps_x_max,
 				!bfs,
-				random_seed? random_seed.Get() : DefaultSolver::default_random_seed);
+				random_seed? random_seed.Get() : DefaultSolver::default_random_seed,
+				nb_threads? nb_threads.Get() : 1,
+				bfs_mem? bfs_mem.Get() : 0);
 
 		if (boundary_test_arg) {
 
@@ -234,6 +262,14 @@ int main(int argc, char** argv) {
 			s.trace=trace.Get();
 		}
 
+		// This option activates the profiler
+		Profiler profiler;
+		if (profile) {
+			if (!quiet)
+				cout << "  profile:\t\t" << profile.Get() << endl;
+			s.profiler=&profiler;
+		}
+
 		if (!quiet) {
 			cout << "*****************************************************************" << endl << endl;
 		}
@@ -265,6 +301,12 @@ int main(int argc, char** argv) {
 			if (overwitten)
 				cout << " (old file saved in " << manifold_copy << ")\n";
 		}
+
+		if (profile) {
+			profiler.save(profile.Get().c_str());
+			if (!quiet)
+				cout << " profiling report written in " << profile.Get() << "\n";
+		}
 		//		if (!quiet && !sols) {
 //			cout << " (note: use --sols to display solutions)" << endl;
 //		}
@@ -11,18 +11,122 @@
 #include "ibex_Cell.h"
 #include "ibex_Bsc.h"
 #include <limits.h>
+#include <sstream>
 #include "ibex_Bxp.h"
-#include "ibex_Bxp.h"
+#include "ibex_BlockPool.h"
+#include <vector>
+#include <cassert>
 
 using namespace std;
 
 namespace ibex {
 
-Cell::Cell(const IntervalVector& box, int var, unsigned int depth) : box(box), prop(this->box), bisected_var(var), depth(depth) {
+namespace {
+
+/*
+ * Free arrays of intervals (storage of cell boxes).
+ *
+ * Only arrays of the same size are kept (the boxes of a search
+ * all have the same dimension). The arrays are allocated with
+ * new[] so that the box of a cell can still be resized.
+ */
+struct BoxPool {
+	BoxPool() : n(0) { }
+
+	~BoxPool() { clear(); }
+
+	Interval* alloc(int n2) {
+		if (n2!=n || boxes.empty())
+			return new Interval[n2];
+		Interval* p=boxes.back();
+		boxes.pop_back();
+		return p;
+	}
+
+	void free(int n2, Interval* p) {
+		if (boxes.empty()) n=n2;
+		if (n2!=n || boxes.size()>=BlockPool::default_max_size)
+			delete[] p;
+		else
+			boxes.push_back(p);
+	}
+
+	void clear() {
+		for (vector<Interval*>::iterator it=boxes.begin(); it!=boxes.end(); ++it)
+			delete[] *it;
+		boxes.clear();
+	}
+
+	int n;
+	vector<Interval*> boxes;
+};
+
+// Set once the pools of the thread are destroyed. The thread_local
+// objects of the main thread are destroyed before the objects with
+// static storage: a cell freed afterwards (e.g., by a global buffer)
+// goes back to the system. A bool is trivially destructible, so the
+// flag can still be read then.
+thread_local bool pools_destroyed=false;
 
+struct CellPools {
+	CellPools() : cells(sizeof(Cell)) { }
+	~CellPools() { pools_destroyed=true; }
+
+	BlockPool cells;
+	BoxPool boxes;
+};
+
+// A cell may be freed by another thread than the one that
+// allocated it (parallel search): its memory simply joins
+// the pools of the thread that deletes it (see BlockPool).
+thread_local CellPools pools;
+
+} // end anonymous namespace
+
+void* Cell::operator new(size_t size) {
+	if (size!=sizeof(Cell) || pools_destroyed)
+		return ::operator new(size);
+	return pools.cells.alloc();
 }
 
-Cell::Cell(const Cell& e) : box(e.box), prop(this->box, e.prop), bisected_var(e.bisected_var), depth(e.depth) {
+void Cell::operator delete(void* p, size_t size) {
+	if (!p) return;
+
+	if (size!=sizeof(Cell) || pools_destroyed)
+		::operator delete(p);
+	else
+		pools.cells.free(p);
+}
+
+size_t Cell::pool_size() {
+	return pools_destroyed? 0 : pools.cells.size();
+}
+
+size_t Cell::box_pool_size() {
+	return pools_destroyed? 0 : pools.boxes.boxes.size();
+}
+
+void Cell::release_pool() {
+	if (pools_destroyed) return;
+	pools.cells.clear();
+	pools.boxes.clear();
+}
+
+IntervalVector Cell::pooled_copy(const IntervalVector& x) {
+	assert(x.vec!=NULL); // forbidden to copy uninitialized boxes
+
+	IntervalVector box;
+	box.n=x.n;
+	box.vec=pools_destroyed? new Interval[x.n] : pools.boxes.alloc(x.n);
+	for (int i=0; i<x.n; i++) box.vec[i]=x.vec[i];
+	return box;
+}
+
+Cell::Cell(const IntervalVector& box, int var, unsigned int depth) : box(pooled_copy(box)), prop(this->box), bisected_var(var), depth(depth) {
+
+}
+
+Cell::Cell(const Cell& e) : box(pooled_copy(e.box)), prop(this->box, e.prop), bisected_var(e.bisected_var), depth(e.depth) {
 
 }
 
@@ -31,26 +135,43 @@ pair<Cell*,Cell*> Cell::bisect(const BisectionPoint& pt) const {
 	Cell* cleft;
 	Cell* cright;
 
+	// The children are built from a copy of the parent box
+	// directly (no intermediate vectors).
+	Interval left, right;
+
 	if (pt.rel_pos) {
-		pair<IntervalVector,IntervalVector> boxes=box.bisect(pt.var,pt.pos);
-		cleft = new Cell(boxes.first, pt.var, depth+1);
-		cright = new Cell(boxes.second, pt.var, depth+1);
+		if (!box[pt.var].is_bisectable()) {
+			std::ostringstream oss;
+			oss << "Unable to bisect " << box;
+			throw InvalidIntervalVectorOp(oss.str());
+		}
+		pair<Interval,Interval> p=box[pt.var].bisect(pt.pos);
+		left = p.first;
+		right = p.second;
 	} else {
-		IntervalVector b1(box);
-		IntervalVector b2(box);
-		b1[pt.var]=Interval(box[pt.var].lb(), pt.pos);
-		b2[pt.var]=Interval(pt.pos, box[pt.var].ub());
-		cleft = new Cell(b1, pt.var, depth+1);
-		cright = new Cell(b2, pt.var, depth+1);
+		left = Interval(box[pt.var].lb(), pt.pos);
+		right = Interval(pt.pos, box[pt.var].ub());
 	}
 
+	cleft = new Cell(box, pt.var, depth+1);
+	cleft->box[pt.var] = left;
+	cright = new Cell(box, pt.var, depth+1);
+	cright->box[pt.var] = right;
+
 	prop.update_bisect(Bisection(box, pt, cleft->box, cright->box), cleft->prop, cright->prop);
 
 	return pair<Cell*,Cell*>(cleft,cright);
 }
 
 Cell::~Cell() {
-
+	if (box.vec) {
+		if (pools_destroyed)
+			delete[] box.vec;
+		else
+			pools.boxes.free(box.n, box.vec);
+		box.vec=NULL;
+		box.n=0;
+	}
 }
 
 std::ostream& operator<<(std::ostream& os, const Cell& c) {
@@ -71,6 +71,41 @@ public:
 	 */
 	virtual ~Cell();
 
+	/**
+	 * \brief Allocate a cell.
+	 *
+	 * Cells and the storage of their boxes are recycled through
+	 * per-thread free lists (see #ibex::BlockPool): the memory of a
+	 * deleted cell is reused by the next allocation in the same thread
+	 * instead of going back to the system allocator. A cell deleted by
+	 * another thread than the one that created it (work stealing) goes to
+	 * the lists of the deleting thread. Each list is bounded
+	 * (BlockPool::default_max_size entries). Sub-classes of Cell use the
+	 * global allocator.
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Release a cell (to the free list of the calling thread).
+	 */
+	static void operator delete(void* p, size_t size);
+
+	/**
+	 * \brief Number of free cells held by the calling thread.
+	 */
+	static size_t pool_size();
+
+	/**
+	 * \brief Number of free box storages held by the calling thread.
+	 */
+	static size_t box_pool_size();
+
+	/**
+	 * \brief Give the free cells (and box storages) of the
+	 * calling thread back to the system allocator.
+	 */
+	static void release_pool();
+
 	/**
 	 * \brief The box
 	 */
@@ -93,6 +128,13 @@ public:
 	 * Cell depth (0 if root node).
 	 */
 	unsigned int depth;
+
+private:
+	/*
+	 * Copy of x whose storage comes from the
+	 * free list of the calling thread.
+	 */
+	static IntervalVector pooled_copy(const IntervalVector& x);
 };
 
 /**
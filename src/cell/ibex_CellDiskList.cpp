@@ -0,0 +1,191 @@
+/* ============================================================================
+ * I B E X - Cell list with out-of-core storage
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CellDiskList.h"
+#include "ibex_BoxEvent.h"
+#include "ibex_Exception.h"
+
+#include <cassert>
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * Format of a cell in the file (or in the memory store):
+ *
+ *   bisected_var (int), depth (unsigned int),
+ *   size in bytes of the encoded box (int), encoded box.
+ */
+
+CellDiskList::CellDiskList(unsigned int max_in_memory, bool use_file) : max_in_memory(max_in_memory),
+		use_file(use_file), file(NULL), read_pos(0), write_pos(0), disk_size(0), proto(NULL),
+		encoder(NULL), decoder(NULL), code(NULL) {
+	assert(max_in_memory>=2);
+}
+
+CellDiskList::~CellDiskList() {
+	flush();
+	if (file) fclose(file);
+}
+
+void CellDiskList::flush() {
+	while (!head.empty()) {
+		delete head.front();
+		head.pop_front();
+	}
+	while (!tail.empty()) {
+		delete tail.front();
+		tail.pop_front();
+	}
+	// the properties may change from one search to the other
+	if (proto) {
+		delete proto;
+		delete encoder;
+		delete decoder;
+		delete[] code;
+		proto=NULL;
+		encoder=decoder=NULL;
+		code=NULL;
+	}
+	read_pos=write_pos=0;
+	disk_size=0;
+	// release the memory store
+	std::vector<unsigned char>().swap(store);
+}
+
+unsigned int CellDiskList::size() const {
+	return head.size()+disk_size+tail.size();
+}
+
+bool CellDiskList::empty() const {
+	return size()==0;
+}
+
+void CellDiskList::push(Cell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+	tail.push_back(cell);
+	if (head.size()+tail.size()>max_in_memory)
+		spill();
+}
+
+Cell* CellDiskList::pop() {
+	load();
+	Cell* c = head.front();
+	head.pop_front();
+	return c;
+}
+
+Cell* CellDiskList::top() const {
+	load();
+	return head.front();
+}
+
+bool CellDiskList::write(const void* data, size_t nb_bytes) {
+	if (use_file) {
+		if (fwrite(data, 1, nb_bytes, file)!=nb_bytes) return false;
+	} else if (nb_bytes>0) {
+		if (store.size()<write_pos+nb_bytes) store.resize(write_pos+nb_bytes);
+		memcpy(&store[write_pos], data, nb_bytes);
+	}
+	write_pos+=nb_bytes;
+	return true;
+}
+
+bool CellDiskList::read(void* data, size_t nb_bytes) const {
+	if (use_file) {
+		if (fread(data, 1, nb_bytes, file)!=nb_bytes) return false;
+	} else if (nb_bytes>0) {
+		if (read_pos+(long) nb_bytes>write_pos) return false;
+		memcpy(data, &store[read_pos], nb_bytes);
+	}
+	read_pos+=nb_bytes;
+	return true;
+}
+
+void CellDiskList::spill() {
+	if (use_file && !file) {
+		file=tmpfile();
+		if (!file) ibex_error("CellDiskList: cannot create a temporary file");
+	}
+
+	if (!proto) {
+		proto=new Cell(*tail.front());
+		encoder=new DeltaBoxCoder(proto->box.size());
+		decoder=new DeltaBoxCoder(proto->box.size());
+		code=new unsigned char[encoder->max_size()];
+	}
+
+	if (use_file) fseek(file, write_pos, SEEK_SET);
+
+	// the oldest cells of the tail come right after
+	// the ones already stored
+	while (!tail.empty() && head.size()+tail.size()>max_in_memory/2) {
+		Cell* c=tail.front();
+		int nb_bytes=encoder->encode(c->box, code);
+
+		if (!write(&c->bisected_var, sizeof(int)) ||
+			!write(&c->depth, sizeof(unsigned int)) ||
+			!write(&nb_bytes, sizeof(int)) ||
+			!write(code, nb_bytes))
+			ibex_error("CellDiskList: cannot write a cell (temporary file or memory store)");
+
+		disk_size++;
+
+		delete c;
+		tail.pop_front();
+	}
+}
+
+void CellDiskList::load() const {
+	if (!head.empty()) return;
+
+	if (disk_size==0) {
+		head.swap(tail);
+		return;
+	}
+
+	if (use_file) fseek(file, read_pos, SEEK_SET);
+
+	// read half of the budget (the other half is for the tail)
+	unsigned int nb=max_in_memory/2;
+	if (nb>disk_size) nb=disk_size;
+
+	for (unsigned int k=0; k<nb; k++) {
+		Cell* c=new Cell(*proto);
+		int nb_bytes;
+
+		if (!read(&c->bisected_var, sizeof(int)) ||
+			!read(&c->depth, sizeof(unsigned int)) ||
+			!read(&nb_bytes, sizeof(int)) ||
+			nb_bytes>decoder->max_size() ||
+			!read(code, nb_bytes)) {
+			delete c;
+			ibex_error("CellDiskList: cannot read a cell (temporary file or memory store)");
+		}
+
+		decoder->decode(code, c->box);
+
+		c->prop.update(BoxEvent(c->box,BoxEvent::CHANGE));
+
+		head.push_back(c);
+	}
+
+	disk_size-=nb;
+
+	// the file (or the store) is reused from the beginning
+	if (disk_size==0) {
+		read_pos=write_pos=0;
+		encoder->reset();
+		decoder->reset();
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,157 @@
+/* ============================================================================
+ * I B E X - Cell list with out-of-core storage
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CELL_DISK_LIST_H__
+#define __IBEX_CELL_DISK_LIST_H__
+
+#include "ibex_CellBuffer.h"
+#include "ibex_DeltaBoxCoder.h"
+
+#include <list>
+#include <vector>
+#include <cstdio>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Cell list with a memory budget.
+ *
+ * For breadth-first search (same order as #ibex::CellList).
+ *
+ * At most (about) \a max_in_memory cells are kept in memory: the first
+ * cells of the list (the next ones to be popped) and the last pushed ones.
+ * The cells in between are written in a temporary (append-only) file
+ * and read back, by blocks, when they reach the front of the list.
+ *
+ * Only the box, the last bisected variable and the depth of a cell are
+ * stored in the file. Boxes are delta-encoded (see #ibex::DeltaBoxCoder):
+ * the two halves of a bisected box, pushed one after the other, only
+ * differ in one bound. The properties of a cell read from the file are
+ * rebuilt from the properties of the first cell ever written in the file,
+ * followed by a #ibex::BoxEvent::CHANGE event on the new box. This is
+ * sound as long as all the cells carry the same properties and
+ * properties can be recomputed from the box only (the case of the
+ * properties used by the solver).
+ *
+ * With \a use_file=false, the encoded cells are stored in memory (in
+ * a byte array) instead of the file. The list is then not out-of-core
+ * anymore but the cells in between take only a few bytes each (instead
+ * of a full #ibex::Cell). In both modes, the first and last cells (at most
+ * \a max_in_memory) are still plain #ibex::Cell objects.
+ *
+ * \see #CellBuffer
+ */
+class CellDiskList : public CellBuffer {
+ public:
+  /**
+   * \brief Create the list.
+   *
+   * \param max_in_memory - maximal number of cells kept in memory
+   *                        as #ibex::Cell objects (at least 2).
+   * \param use_file      - whether the encoded cells are stored in a
+   *                        temporary file (default) or in memory.
+   */
+  explicit CellDiskList(unsigned int max_in_memory, bool use_file=true);
+
+  /**
+   * \brief Delete this (remaining cells are deleted).
+   */
+  ~CellDiskList();
+
+  /** Flush the buffer.
+   * All the remaining cells will be *deleted* */
+  void flush();
+
+  /** Return the size of the buffer. */
+  unsigned int size() const;
+
+  /** Return true if the buffer is empty. */
+  bool empty() const;
+
+  /** push a new cell on the back of the list. */
+  void push(Cell* cell);
+
+  /** Pop a cell from the front of list and return it.*/
+  Cell* pop();
+
+  /** Return the next box (but does not pop it).*/
+  Cell* top() const;
+
+  /** Number of cells currently stored encoded (in the file or in memory). */
+  unsigned int nb_on_disk() const;
+
+  /** Number of bytes used by the encoded cells. */
+  long encoded_size() const;
+
+  /** Maximal number of cells kept in memory. */
+  const unsigned int max_in_memory;
+
+  /** Whether the encoded cells are stored in a file. */
+  const bool use_file;
+
+ private:
+  /* Write the oldest cells of the tail until at most
+   * max_in_memory/2 cells are in memory. */
+  void spill();
+
+  /* Fill the front list (if empty) from the file
+   * or from the tail. */
+  void load() const;
+
+  /* Write/read bytes at write_pos/read_pos in the
+   * file or in the memory store (false if failed). */
+  bool write(const void* data, size_t nb_bytes);
+  bool read(void* data, size_t nb_bytes) const;
+
+  /* First cells of the list (popped first) */
+  mutable std::list<Cell*> head;
+
+  /* Last cells of the list (pushed last) */
+  mutable std::list<Cell*> tail;
+
+  /* Temporary file (NULL until the first spill,
+   * or if use_file==false) */
+  std::FILE* file;
+
+  /* Encoded cells if use_file==false */
+  std::vector<unsigned char> store;
+
+  /* Position of the first cell stored in the file
+   * (or the store), and end of the cells (in bytes). */
+  mutable long read_pos, write_pos;
+
+  /* Number of cells stored in the file (or the store) */
+  mutable unsigned int disk_size;
+
+  /* Cell whose properties are duplicated
+   * for the cells read from the file. */
+  Cell* proto;
+
+  /* Coders of the boxes written in/read from
+   * the file (NULL until the first spill) */
+  DeltaBoxCoder* encoder;
+  DeltaBoxCoder* decoder;
+
+  /* Buffer for an encoded box */
+  unsigned char* code;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline unsigned int CellDiskList::nb_on_disk() const {
+	return disk_size;
+}
+
+inline long CellDiskList::encoded_size() const {
+	return write_pos-read_pos;
+}
+
+} // end namespace ibex
+#endif // __IBEX_CELL_DISK_LIST_H__
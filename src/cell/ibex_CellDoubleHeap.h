@@ -118,13 +118,22 @@ protected:
 	 * The system
 	 */
 	const ExtendedSystem& sys;
+
+private:
+	CellDoubleHeap(const ExtendedSystem& sys, int crit2_pr, CellCostFunc* cost2);
 };
 
 /*================================== inline implementations ========================================*/
 
 inline CellDoubleHeap::CellDoubleHeap(const ExtendedSystem& sys, int crit2_pr, CellCostFunc::criterion crit2) :
+		CellDoubleHeap(sys, crit2_pr, CellCostFunc::get_cost(sys, crit2, sys.goal_var())) {
+}
+
+inline CellDoubleHeap::CellDoubleHeap(const ExtendedSystem& sys, int crit2_pr, CellCostFunc* cost2) :
+		// the costs of the second heap are recalculated (after
+		// a contraction) only if they depend on the loup
 		DoubleHeap<Cell>(*new CellCostVarLB(sys, sys.goal_var()), false,
-				*CellCostFunc::get_cost(sys, crit2, sys.goal_var()), true /* TODO: give right value */, crit2_pr),
+				*cost2, cost2->depends_on_loup, crit2_pr),
 		sys(sys) {
 }
 
@@ -140,7 +149,7 @@ inline void CellDoubleHeap::contract(double new_loup) {
 	// the first heap to be up-to-date.
 	if (cost1().depends_on_loup) {
 		cost1().set_loup(new_loup);
-		heap1->sort();
+		sort1();
 	}
 
 	cost2().set_loup(new_loup);
@@ -183,6 +192,7 @@ inline std::ostream& CellDoubleHeap::print(std::ostream& os) const {
 		return os << " EMPTY heap" << std::endl;
 	} else {
 		os << " first heap " << " size " << heap1->size() << " top " << heap1->top()->box << std::endl;
+		update2();
 		os << " second heap " << " size " << heap2->size() << " top " << heap2->top()->box ;
 		return  os << std::endl;
 	}
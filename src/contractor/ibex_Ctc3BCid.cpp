@@ -11,13 +11,18 @@
 
 #include "ibex_Ctc3BCid.h"
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <exception>
+#endif
+
 using namespace std;
 namespace ibex {
 
 Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
 									Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? cid_vars.size():vhandled),
-									var_min_width(var_min_width), start_var(0) {
+									var_min_width(var_min_width), start_var(0), context(NULL), nb_threads(1) {
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
 	//		ibex_error("Ctc3BCID : the contractor is non-dimensional, Please specify the dimension with: \n Ctc3BCid(int nb_var, const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width);");
@@ -27,7 +32,7 @@ Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhan
 Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
                     				Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? nb_var : vhandled),
-									var_min_width(var_min_width), start_var(0), context(NULL) {
+									var_min_width(var_min_width), start_var(0), context(NULL), nb_threads(1) {
 
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
@@ -35,7 +40,24 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 Ctc3BCid::~Ctc3BCid() {
+	for (vector<Ctc3BCid*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		delete *it;
+}
 
+void Ctc3BCid::set_parallel(const Array<Ctc>& clones) {
+#ifndef _WIN32
+	for (vector<Ctc3BCid*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		delete *it;
+	workers.clear();
+
+	for (int i=0; i<clones.size(); i++) {
+		assert(clones[i].nb_var==nb_var);
+		workers.push_back(new Ctc3BCid(cid_vars, clones[i], s3b, scid, 1, var_min_width));
+	}
+	nb_threads = clones.size()+1;
+#else
+	if (clones.size()>0) ibex_warning("[Ctc3BCid] parallel mode not supported on this platform");
+#endif
 }
 
 void Ctc3BCid::add_property(const IntervalVector& init_box, BoxProperties& map) {
@@ -70,6 +92,22 @@ void Ctc3BCid::contract(IntervalVector& box, ContractContext& context) {
 
 	this->context = &context;
 
+	if (nb_threads>1) {
+		vector<int> vars(vhandled);
+		for (int k=0; k<vhandled; k++)
+			vars[k]=(start_var+k)%nb_var;
+
+		vector<IntervalVector> boxes;
+		var3BCID_parallel(box, vars, boxes);
+
+		if (box.is_empty())
+			context.output_flags.add(FIXPOINT);
+		else
+			context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
+		this->context = NULL;
+		return;
+	}
+
 	for (int k=0; k<vhandled; k++) {                   // [gch] k counts the number of varCIDed variables [gch]
 
 		var=(start_var+k)%nb_var;
@@ -89,6 +127,71 @@ void Ctc3BCid::contract(IntervalVector& box, ContractContext& context) {
 }
 
 
+#ifndef _WIN32
+
+void Ctc3BCid::var3BCID_parallel(IntervalVector& box, const vector<int>& vars, vector<IntervalVector>& boxes) {
+
+	int n=vars.size();
+	int nb_groups=std::min(nb_threads, n);
+
+	boxes.assign(n, box);
+
+	// each worker has its own context (the properties are copied)
+	vector<ContractContext*> contexts(nb_groups, NULL);
+	for (int k=1; k<nb_groups; k++) {
+		contexts[k]=new ContractContext(box, *context);
+		workers[k-1]->context=contexts[k];
+	}
+
+	vector<exception_ptr> error(nb_groups);
+
+	auto task = [&](int k) {
+		try {
+			Ctc3BCid& shaving = k==0 ? *this : *workers[k-1];
+			IntervalVector b(box);
+			for (int i=k; i<n; i+=nb_groups) {
+				if (!b.is_empty())
+					shaving.var3BCID(b, vars[i]);
+				boxes[i]=b;
+			}
+		} catch(...) {
+			error[k]=current_exception();
+		}
+	};
+
+	vector<thread> threads;
+	for (int k=1; k<nb_groups; k++)
+		threads.push_back(thread(task, k));
+
+	task(0);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	for (int k=1; k<nb_groups; k++) {
+		workers[k-1]->context=NULL;
+		delete contexts[k];
+	}
+
+	for (int k=0; k<nb_groups; k++) {
+		if (error[k]) rethrow_exception(error[k]);
+		box &= boxes[n-1-(n-1-k)%nb_groups]; // last box of the kth thread
+	}
+}
+
+#else
+
+void Ctc3BCid::var3BCID_parallel(IntervalVector& box, const vector<int>& vars, vector<IntervalVector>& boxes) {
+	boxes.assign(vars.size(), box);
+	for (size_t i=0; i<vars.size(); i++) {
+		if (!box.is_empty())
+			var3BCID(box, vars[i]);
+		boxes[i]=box;
+	}
+}
+
+#endif
+
 bool Ctc3BCid::var3BCID(IntervalVector& box, int var) {
 
 	Interval& dom(box[var]);
@@ -14,6 +14,9 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_Array.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -128,6 +131,22 @@ public:
 	 */
 	virtual void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Shave several variables in parallel.
+	 *
+	 * \param clones - Copies of the sub-contractor, one per additional thread
+	 *                 (with n clones, n+1 threads are used). The clones must not share
+	 *                 data with \a ctc or with each other. In particular, if the
+	 *                 sub-contractor is built from a system, each clone must be
+	 *                 built from its own copy of the system.
+	 *
+	 * The variables to be shaved are dispatched to the threads in a round-robin
+	 * fashion. Each thread shaves its variables on its own copy of the box and the
+	 * boxes are intersected at the end. The contraction is therefore slightly different
+	 * (generally less sharp) than with sequential shaving.
+	 */
+	void set_parallel(const Array<Ctc>& clones);
+
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
@@ -250,6 +269,24 @@ protected:
 	ContractContext* context;
 
 	virtual int limitCIDDichotomy();
+
+	/**
+	 * Applies var3BCID on the variables vars[0], vars[1], ... in parallel (see
+	 * #set_parallel()): the kth thread shaves vars[k], vars[k+#nb_threads], ...
+	 * on its own copy of \a box. The box obtained after shaving vars[i] is stored
+	 * in boxes[i] and \a box is set to the intersection of the final boxes.
+	 */
+	void var3BCID_parallel(IntervalVector& box, const std::vector<int>& vars, std::vector<IntervalVector>& boxes);
+
+	/** Number of threads (1 by default, see #set_parallel()). */
+	int nb_threads;
+
+private:
+	/*
+	 * Shaving of the additional threads: one per
+	 * clone of the sub-contractor (see #set_parallel()).
+	 */
+	std::vector<Ctc3BCid*> workers;
 };
 
 } // end namespace ibex
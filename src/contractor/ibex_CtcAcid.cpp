@@ -33,6 +33,22 @@ void CtcAcid::contract(IntervalVector& box) {
 	contract(box,context);
 }
 
+namespace {
+
+// gain moyen sur les dimensions de la boîte courante après var3BCID
+double shaving_gain(const IntervalVector& initbox, const IntervalVector& box) {
+	double gain=0;
+	for (int i=0; i<initbox.size(); i++) {
+		//cout << i << " initbox " << initbox[i].diam() << " box " << box[i].diam() << endl;
+		if  (initbox[i].diam() !=0 && box[i].diam()!= POS_INFINITY)
+			// gain sur la ième dimension
+			gain += 1  - box[i].diam() / initbox[i].diam();
+	}
+	return gain / initbox.size();
+}
+
+}
+
 void CtcAcid::contract(IntervalVector& box, ContractContext& context) {
 	// the initial contraction allows to set, after, the impact
 	// to only one variable (in the slicing process). However, it turns
@@ -77,6 +93,26 @@ void CtcAcid::contract(IntervalVector& box, ContractContext& context) {
 
 	if (vhandled > 0) compute_smearorder(box);         // l'ordre sur les variables est calculé avec la smearsumrel
 	if (optim) putobjfirst();                         // pour l'optim (si optim mis à true dans le constructeur, la dernière variable (objectf) est mise en premier
+	if (nb_threads>1 && vhandled>1) {                  // parallel shaving (see Ctc3BCid::set_parallel)
+		vector<int> vars(vhandled);
+		for (int v=0; v<vhandled; v++)
+			vars[v]=smearorder[v%nb_CID_var];
+
+		vector<IntervalVector> boxes;
+		var3BCID_parallel(box, vars, boxes);
+
+		if (box.is_empty()) {
+			context.output_flags.add(FIXPOINT);
+			this->context = NULL;
+			delete[] ctstat;
+			return;
+		}
+
+		if (nbcall1 < nbinitcalls)                     // the gain of vars[v] is measured w.r.t. the box of its thread
+			for (int v=0; v<vhandled; v++)
+				ctstat[v]=shaving_gain(v<nb_threads? initbox : boxes[v-nb_threads], boxes[v]);
+	}
+	else
 	for (int v=0; v<vhandled; v++) {
 		int v1=v%nb_CID_var;                               // [gch] how can v be < nb_var?? [bne]  vhandled can be between 0 and nbvarmax
 		int v2=smearorder[v1];
@@ -92,14 +128,8 @@ void CtcAcid::contract(IntervalVector& box, ContractContext& context) {
 			return;
 		}
 
-		if (nbcall1 < nbinitcalls) {                   // on fait des stats pour le réglage courant
-			for (int i=0; i<initbox.size(); i++) {
-				//cout << i << " initbox " << initbox[i].diam() << " box " << box[i].diam() << endl;
-				if  (initbox[i].diam() !=0 && box[i].diam()!= POS_INFINITY)
-					// gain sur la ième dimension de la boîte courante après var3BCID sur la v-ième variable
-					ctstat[v] += 1  - box[i].diam() / initbox[i].diam();}
-			ctstat[v]=ctstat[v]/ initbox.size();   // gain moyen
-		}
+		if (nbcall1 < nbinitcalls)                     // on fait des stats pour le réglage courant
+			ctstat[v]=shaving_gain(initbox, box);
 
 		initbox=box;
 	}
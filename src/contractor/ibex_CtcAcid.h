@@ -31,6 +31,9 @@ namespace ibex {
  *
  * <li> large running phases (during e.g. 950 nodes)
  *      where 3BCID is called with the  number of variables determined during the last tuning phase.
+ *
+ * The variables can be shaved in parallel (see #Ctc3BCid::set_parallel()); the gain of each
+ * variable is then measured on the box obtained by its own shaving.
  */
 
 class CtcAcid : public Ctc3BCid {
@@ -13,6 +13,7 @@
 #include "ibex_BxpActiveCtr.h"
 #include "ibex_BxpSystemCache.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_HC4Revise.h"
 
 using namespace std;
 
@@ -75,6 +76,7 @@ void CtcFwdBwd::init() {
 //	output = new BitSet(ctr.f.used_vars);
 	input = new BitSet(nb_var);
 	output = new BitSet(nb_var);
+	incremental_revise = false;
 	
 	for (vector<int>::const_iterator it=ctr.f.used_vars.begin(); it!=ctr.f.used_vars.end(); it++) {
 		output->add(*it);
@@ -129,8 +131,12 @@ void CtcFwdBwd::contract(IntervalVector& box, ContractContext& context) {
 		return;
 	}
 
+	// note: the evaluators depend on the thread
+	HC4Revise& hc4r=ctr.f.hc4revise();
+	if (incremental_revise) hc4r.incremental=true;
+
 	//std::cout << " hc4 of " << f << "=" << d << " with box=" << box << std::endl;
-	if (ctr.f.backward(d,box)) {
+	if (hc4r.proj(d,box)) {
 		if (p) p->set_inactive();
 		if (sp) sp->active_ctrs().remove(ctr_num);
 		context.output_flags.add(INACTIVE);
@@ -96,6 +96,14 @@ public:
 	/** The constraint. */
 	const NumConstraint& ctr;
 
+	/**
+	 * \brief Incremental forward-backward (default: false).
+	 *
+	 * If true, the HC4Revise of the function used by the calling
+	 * thread is switched to incremental mode (see #HC4Revise::incremental).
+	 */
+	bool incremental_revise;
+
 protected:
 	void init();
 
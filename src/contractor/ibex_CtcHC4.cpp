@@ -45,4 +45,9 @@ CtcHC4::~CtcHC4() {
 		delete &list[i];
 }
 
+void CtcHC4::set_incremental_revise(bool incr) {
+	for (int i=0; i<list.size(); i++)
+		((CtcFwdBwd&) list[i]).incremental_revise=incr;
+}
+
 } // end namespace ibex
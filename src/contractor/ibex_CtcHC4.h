@@ -44,6 +44,13 @@ class CtcHC4 : public CtcPropag {
    * \brief Delete *this.
    */
   ~CtcHC4();
+
+  /**
+   * \brief Set the incremental mode of all the forward-backward contractors.
+   *
+   * \see #ibex::CtcFwdBwd::incremental_revise
+   */
+  void set_incremental_revise(bool incr);
 };
 
 
@@ -14,7 +14,8 @@
 namespace ibex {
 
 CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		sparse(false), precond_block(default_sparse_precond_block) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -22,13 +23,22 @@ CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
 }
 
 CtcNewton::CtcNewton(const Fnc& f, const VarSet& vars, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		sparse(false), precond_block(default_sparse_precond_block) {
 
 	if (vars.nb_var!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
 	}
 }
 
+void CtcNewton::set_sparse(bool sparse, int precond_block) {
+	if (sparse && (vars || !dynamic_cast<const Function*>(&f))) {
+		not_implemented("Sparse Newton operator with a sub-set of variables or a non-symbolic function.");
+	}
+	this->sparse=sparse;
+	this->precond_block=precond_block;
+}
+
 void CtcNewton::contract(IntervalVector& box) {
 	ContractContext context(box);
 	contract(box,context);
@@ -37,7 +47,9 @@ void CtcNewton::contract(IntervalVector& box) {
 void CtcNewton::contract(IntervalVector& box, ContractContext& context) {
 	if (!(box.max_diam()<=ceil)) return;
 	else {
-		if (!vars)
+		if (sparse)
+			sparse_newton((const Function&) f,box,prec,gauss_seidel_ratio,precond_block);
+		else if (!vars)
 			newton(f,box,prec,gauss_seidel_ratio);
 		else
 			newton(f,*vars,box,prec,gauss_seidel_ratio);
@@ -53,6 +53,17 @@ public:
 
 	void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Use the sparse variant of the Newton operator (default: false).
+	 *
+	 * See #ibex::sparse_newton(const Function&, IntervalVector&, double, double, int).
+	 * The Jacobian is preconditioned by blocks of \a precond_block equations
+	 * (0 means no preconditioning).
+	 *
+	 * \pre f is a #ibex::Function and no sub-set of variables is given.
+	 */
+	void set_sparse(bool sparse, int precond_block=default_sparse_precond_block);
+
 	/** The function. */
 	const Fnc& f;
 
@@ -74,6 +85,13 @@ public:
 	/** Initialized to 0.01 */
 	static constexpr double default_ceil = 0.01;
 
+protected:
+	/* Sparse mode (see #set_sparse()) */
+	bool sparse;
+
+	/* Size of the blocks of the sparse preconditioner */
+	int precond_block;
+
 };
 
 } // end namespace ibex
@@ -12,6 +12,11 @@
 
 #include "ibex_LinearizerFixed.h"
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <exception>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -26,7 +31,7 @@ CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, dou
 		Ctc(lr.nb_var()), lr(lr),
 		mylinearsolver(nb_var, LPSolver::Mode::Certified, eps, time_out, max_iter),
 		contracted_vars(BitSet::all(nb_var)), own_lr(false), primal_sols(2*nb_var, nb_var),
-		primal_sol_found(2*nb_var) {
+		primal_sol_found(2*nb_var), nb_threads(1) {
 
 }
 
@@ -34,12 +39,14 @@ CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter,
 		Ctc(A.nb_cols()), lr(*new LinearizerFixed(A,b)),
 		mylinearsolver(nb_var, LPSolver::Mode::Certified, eps, time_out, max_iter),
 		contracted_vars(BitSet::all(nb_var)), own_lr(true), primal_sols(2*nb_var, nb_var),
-		primal_sol_found(2*nb_var) {
+		primal_sol_found(2*nb_var), nb_threads(1) {
 
 }
 
 CtcPolytopeHull::~CtcPolytopeHull() {
 	if (own_lr) delete &lr;
+	for (vector<LPSolver*>::iterator it=lp_clones.begin(); it!=lp_clones.end(); ++it)
+		delete *it;
 }
 
 void CtcPolytopeHull::add_property(const IntervalVector& init_box, BoxProperties& map) {
@@ -86,7 +93,105 @@ void CtcPolytopeHull::set_contracted_vars(const BitSet& vars) {
 	contracted_vars = vars;
 }
 
+void CtcPolytopeHull::set_nb_threads(int n) {
+#ifndef _WIN32
+	nb_threads = n<1 ? 1 : n;
+	while ((int) lp_clones.size()<nb_threads-1)
+		lp_clones.push_back(new LPSolver(nb_var, LPSolver::Mode::Certified, mylinearsolver.tolerance(),
+				mylinearsolver.timeout(), mylinearsolver.max_iter()));
+#else
+	if (n>1) ibex_warning("[CtcPolytopeHull] parallel mode not supported on this platform");
+#endif
+}
+
 void CtcPolytopeHull::optimizer(IntervalVector& box) {
+#ifndef _WIN32
+	if (nb_threads>1) {
+		parallel_optimizer(box);
+		return;
+	}
+#endif
+	optimizer(box, mylinearsolver, contracted_vars, primal_sol_found);
+}
+
+#ifndef _WIN32
+
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box) {
+
+	// the contracted variables are dispatched in a round-robin fashion
+	int nb_groups=std::min(nb_threads, contracted_vars.size());
+	vector<BitSet> vars(nb_groups, BitSet::empty(nb_var));
+	int j=0;
+	for (int i=0; i<nb_var; i++)
+		if (contracted_vars[i]) vars[j++ % nb_groups].add(i);
+
+	if (nb_groups<=1) {
+		optimizer(box, mylinearsolver, contracted_vars, primal_sol_found);
+		return;
+	}
+
+	vector<LPSolver*> lp(nb_groups);
+	lp[0]=&mylinearsolver;
+	for (int k=1; k<nb_groups; k++) {
+		lp[k]=lp_clones[k-1];
+		lp[k]->clear_constraints();
+	}
+
+	// copy the linearization (the first nb_var rows are the bound constraints)
+	for (int r=nb_var; r<mylinearsolver.nb_rows(); r++) {
+		Vector row=mylinearsolver.row(r);
+		Interval b=mylinearsolver.lhs_rhs(r);
+		for (int k=1; k<nb_groups; k++) {
+			if (b.lb()==NEG_INFINITY)
+				lp[k]->add_constraint(row, LEQ, b.ub());
+			else if (b.ub()==POS_INFINITY)
+				lp[k]->add_constraint(row, GEQ, b.lb());
+			else
+				lp[k]->add_constraint(b.lb(), row, b.ub());
+		}
+	}
+
+	vector<IntervalVector> boxes(nb_groups, box);
+	vector<BitSet> found(nb_groups, BitSet::empty(2*nb_var));
+	vector<exception_ptr> error(nb_groups);
+
+	auto task = [&](int k) {
+		try {
+			optimizer(boxes[k], *lp[k], vars[k], found[k]);
+		} catch(PolytopeHullEmptyBoxException&) {
+			boxes[k].set_empty();
+		} catch(...) {
+			error[k]=current_exception();
+		}
+	};
+
+	vector<thread> threads;
+	for (int k=1; k<nb_groups; k++)
+		threads.push_back(thread(task, k));
+
+	task(0);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	for (int k=0; k<nb_groups; k++) {
+		if (error[k]) rethrow_exception(error[k]);
+		primal_sol_found |= found[k];
+		box &= boxes[k];
+	}
+
+	if (box.is_empty()) throw PolytopeHullEmptyBoxException();
+}
+
+#else
+
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box) {
+	optimizer(box, mylinearsolver, contracted_vars, primal_sol_found);
+}
+
+#endif
+
+void CtcPolytopeHull::optimizer(IntervalVector& box, LPSolver& lp, const BitSet& vars, BitSet& found) {
 
 	Interval opt(0.0);
 	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
@@ -94,7 +199,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 
 	for (int i=0; i<nb_var; i++) {
 
-		if (contracted_vars[i]) {
+		if (vars[i]) {
 			inf_bound[i]=0;
 			sup_bound[i]=0;
 		} else {
@@ -108,7 +213,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 	LPSolver::Status stat=LPSolver::Status::Unknown;
 
 	// Update the bounds the variables
-	mylinearsolver.set_bounds(box);
+	lp.set_bounds(box);
 
 	for(int ii=0; ii<(2*nb_var); ii++) {  // at most 2*n calls
 
@@ -119,27 +224,27 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		if (infnexti==0 && inf_bound[i]==0)  // computing the left bound : minimizing x_i
 		{
 			inf_bound[i]=1;
-			mylinearsolver.set_cost(i, 1.0);
-			stat = mylinearsolver.minimize();
-			mylinearsolver.set_cost(i, 0.0);
+			lp.set_cost(i, 1.0);
+			stat = lp.minimize();
+			lp.set_cost(i, 0.0);
 			//cout << "[polytope-hull]->[optimize] simplex for left bound returns stat:" << stat << endl;
 			if (stat == LPSolver::Status::OptimalProved) {
-				opt = mylinearsolver.minimum();
+				opt = lp.minimum();
 				//std::cout << "opt=" << opt << endl;
 				if(opt.lb()>box[i].ub()) {
 					delete[] inf_bound;
 					delete[] sup_bound;
 					throw PolytopeHullEmptyBoxException();
 				}
-				primal_sols[2*i]=mylinearsolver.not_proved_primal_sol();
-				primal_sol_found.add(2*i);
+				primal_sols[2*i]=lp.not_proved_primal_sol();
+				found.add(2*i);
 
 				if(opt.lb() > box[i].lb()) {
 					box[i]=Interval(opt.lb(),box[i].ub());
-					mylinearsolver.set_bounds(i,box[i]);
+					lp.set_bounds(i,box[i]);
 				}
 
-				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
+				if (!choose_next_variable(lp,box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
 				}
 			}
@@ -173,12 +278,12 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else if (infnexti==1 && sup_bound[i]==0) { // computing the right bound :  maximizing x_i
 			sup_bound[i]=1;
-			mylinearsolver.set_cost(i, -1.0);
-			stat= mylinearsolver.minimize();
-			mylinearsolver.set_cost(i, 0.0);
+			lp.set_cost(i, -1.0);
+			stat= lp.minimize();
+			lp.set_cost(i, 0.0);
 			//cout << "[polytope-hull]->[optimize] simplex for right bound returns stat=" << stat << endl;
 			if( stat == LPSolver::Status::OptimalProved) {
-				opt = -mylinearsolver.minimum();
+				opt = -lp.minimum();
 				//std::cout << "opt=" << opt << endl;
 				if(opt.ub() <box[i].lb()) {
 					delete[] inf_bound;
@@ -186,15 +291,15 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 					throw PolytopeHullEmptyBoxException();
 				}
 
-				primal_sols[2*i+1]=mylinearsolver.not_proved_primal_sol();
-				primal_sol_found.add(2*i+1);
+				primal_sols[2*i+1]=lp.not_proved_primal_sol();
+				found.add(2*i+1);
 
 				if (opt.ub() < box[i].ub()) {
 					box[i] =Interval( box[i].lb(), opt.ub());
-					mylinearsolver.set_bounds(i,box[i]);
+					lp.set_bounds(i,box[i]);
 				}
 
-				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
+				if (!choose_next_variable(lp,box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
 				}
 			}
@@ -231,10 +336,14 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 }
 
 bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
+	return choose_next_variable(mylinearsolver, box, nexti, infnexti, inf_bound, sup_bound);
+}
+
+bool CtcPolytopeHull::choose_next_variable(LPSolver& lp, IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
 
 	bool found = false;
 	// the primal solution : used by choose_next_variable
-	Vector primal_solution = mylinearsolver.not_proved_primal_sol();
+	Vector primal_solution = lp.not_proved_primal_sol();
 	//cout << " primal " << primal_solution << endl;
 
 	// The Achterberg heuristic for choosing the next variable (nexti) and its bound (infnexti) to be contracted (cf Baharev paper)
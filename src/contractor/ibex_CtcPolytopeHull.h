@@ -16,6 +16,8 @@
 #include "ibex_LPSolver.h"
 #include "ibex_BitSet.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -92,6 +94,21 @@ public:
 	 */
 	void set_contracted_vars(const BitSet& vars);
 
+	/**
+	 * \brief Set the number of threads (default: 1).
+	 *
+	 * With n>1 threads, the contracted variables are split into n groups
+	 * and the LPs of each group (minimization and maximization of each
+	 * variable) are solved by a separate thread, on its own copy of the
+	 * linear solver. All the threads share the same linearization and
+	 * the box is intersected at the end.
+	 *
+	 * A bound contracted by one thread is only taken into account by the
+	 * LPs of this thread, so that the result may be slightly less sharp
+	 * than with a single thread.
+	 */
+	void set_nb_threads(int n);
+
 	/**
 	 * \brief Return the argmin of one LP problem
 	 *
@@ -115,10 +132,27 @@ protected:
 	bool choose_next_variable(IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
 
 	/**
-	 * TODO: add comment.
+	 * Same as above, with the primal solution of the LP solver \a lp.
+	 */
+	bool choose_next_variable(LPSolver& lp, IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
+
+	/**
+	 * Contract the bounds of the box (calls to the LP solver).
 	 */
 	void optimizer(IntervalVector &box);
 
+	/**
+	 * Contract the bounds of the variables in \a vars with the
+	 * LP solver \a lp (the constraints must already be set).
+	 * The primal solutions found are added to \a found.
+	 */
+	void optimizer(IntervalVector &box, LPSolver& lp, const BitSet& vars, BitSet& found);
+
+	/**
+	 * Parallel version of optimizer(IntervalVector&).
+	 */
+	void parallel_optimizer(IntervalVector &box);
+
 	/**
 	 * \brief The linearization technique
 	 */
@@ -149,6 +183,13 @@ private:
 	 *  solution has been found.
 	 */
 	BitSet primal_sol_found;
+
+	/*
+	 * Number of threads and copies of the linear solver
+	 * (one per thread, except the first one).
+	 */
+	int nb_threads;
+	std::vector<LPSolver*> lp_clones;
 };
 
 /*================================== inline implementations ========================================*/
@@ -0,0 +1,126 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+//============================================================================
+
+#include "ibex_CtcProfiler.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFixPoint.h"
+
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+CtcProfiler::CtcProfiler(Ctc& ctc, Profiler& profiler, const string& name) :
+		Ctc(ctc.nb_var), ctc(ctc), profiler(profiler), entry(profiler.entry(name)) {
+	input=ctc.input;
+	output=ctc.output;
+}
+
+CtcProfiler::~CtcProfiler() {
+
+}
+
+void CtcProfiler::contract(IntervalVector& box) {
+	IntervalVector before(box);
+	double t=Profiler::now();
+	// note: contractors signal an empty box by emptying it
+	// (an exception, e.g., a time out, is not recorded)
+	ctc.contract(box);
+	profiler.add(entry, Profiler::now()-t, before, box);
+}
+
+void CtcProfiler::contract(IntervalVector& box, ContractContext& context) {
+	IntervalVector before(box);
+	double t=Profiler::now();
+	// note: contractors signal an empty box by emptying it
+	// (an exception, e.g., a time out, is not recorded)
+	ctc.contract(box, context);
+	profiler.add(entry, Profiler::now()-t, before, box);
+}
+
+void CtcProfiler::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	ctc.add_property(init_box, map);
+}
+
+void CtcProfiler::instrument(Ctc& ctc, Profiler& profiler, const string& path) {
+
+	CtcCompo* compo=dynamic_cast<CtcCompo*>(&ctc);
+
+	if (compo) {
+		Array<Ctc> list(compo->list);
+		compo->list.clear(); // references are reset one by one below
+
+		for (int i=0; i<list.size(); i++) {
+			Ctc& sub=list[i];
+
+			if (dynamic_cast<CtcProfiler*>(&sub)) { // already instrumented
+				compo->list.set_ref(i, sub);
+				continue;
+			}
+
+			stringstream sub_path;
+			if (!path.empty()) sub_path << path << '.';
+			sub_path << i;
+
+			instrument(sub, profiler, sub_path.str());
+
+			compo->list.set_ref(i, *new CtcProfiler(sub, profiler,
+					sub_path.str()+" "+Profiler::type_name(typeid(sub))));
+		}
+		return;
+	}
+
+	CtcFixPoint* fixpoint=dynamic_cast<CtcFixPoint*>(&ctc);
+
+	if (fixpoint)
+		instrument(fixpoint->ctc, profiler, path);
+}
+
+void CtcProfiler::restore(Ctc& ctc) {
+
+	CtcCompo* compo=dynamic_cast<CtcCompo*>(&ctc);
+
+	if (compo) {
+		Array<Ctc> list(compo->list);
+		compo->list.clear();
+
+		for (int i=0; i<list.size(); i++) {
+			CtcProfiler* p=dynamic_cast<CtcProfiler*>(&list[i]);
+			if (p) {
+				compo->list.set_ref(i, p->ctc);
+				delete p;
+			} else
+				compo->list.set_ref(i, list[i]);
+			restore(compo->list[i]);
+		}
+		return;
+	}
+
+	CtcFixPoint* fixpoint=dynamic_cast<CtcFixPoint*>(&ctc);
+
+	if (fixpoint)
+		restore(fixpoint->ctc);
+}
+
+CtcProfilerScope::CtcProfilerScope(Profiler* profiler) : profiler(profiler) {
+
+}
+
+void CtcProfilerScope::add(Ctc& ctc) {
+	if (!profiler) return;
+	CtcProfiler::instrument(ctc, *profiler);
+	ctcs.push_back(&ctc);
+}
+
+CtcProfilerScope::~CtcProfilerScope() {
+	for (vector<Ctc*>::iterator it=ctcs.begin(); it!=ctcs.end(); ++it)
+		CtcProfiler::restore(**it);
+}
+
+} // end namespace ibex
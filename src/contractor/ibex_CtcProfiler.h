@@ -0,0 +1,122 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcProfiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_PROFILER_H__
+#define __IBEX_CTC_PROFILER_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Profiler.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Profiled contractor.
+ *
+ * Behaves like the contractor it wraps and records every call
+ * (time, volume reduction, emptiness) in a profiler.
+ *
+ * The static functions #instrument and #restore replace, in place, all
+ * the sub-contractors of a composition (see #ibex::CtcCompo and
+ * #ibex::CtcFixPoint) by profiled contractors, and conversely.
+ */
+class CtcProfiler : public Ctc {
+public:
+	/**
+	 * \brief Wrap \a ctc. Calls are recorded in the entry \a name.
+	 */
+	CtcProfiler(Ctc& ctc, Profiler& profiler, const std::string& name);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~CtcProfiler();
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box, ContractContext& context);
+
+	/**
+	 * \brief Add the properties of the wrapped contractor.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Wrap recursively the sub-contractors of \a ctc.
+	 *
+	 * The sub-contractors of a CtcCompo are replaced by profiled
+	 * contractors, named by their position in the tree (e.g., "3.1 CtcHC4"
+	 * is the 2nd sub-contractor of the 4th sub-contractor of \a ctc).
+	 * The sub-contractor of a CtcFixPoint is not wrapped (it cannot be
+	 * replaced) but its own sub-contractors are.
+	 *
+	 * \a ctc itself is not wrapped.
+	 */
+	static void instrument(Ctc& ctc, Profiler& profiler, const std::string& path="");
+
+	/**
+	 * \brief Undo #instrument.
+	 */
+	static void restore(Ctc& ctc);
+
+	/**
+	 * \brief The wrapped contractor.
+	 */
+	Ctc& ctc;
+
+	/**
+	 * \brief The profiler.
+	 */
+	Profiler& profiler;
+
+	/**
+	 * \brief The entry of the profiler.
+	 */
+	Profiler::Entry& entry;
+};
+
+/**
+ * \ingroup contractor
+ * \brief Instrumentation of contractors for the lifetime of an object.
+ *
+ * Contractors added are instrumented (see #CtcProfiler::instrument)
+ * until the object is deleted. Nothing is done if the profiler is NULL.
+ */
+class CtcProfilerScope {
+public:
+	/**
+	 * \brief Create a scope for a profiler (possibly NULL).
+	 */
+	explicit CtcProfilerScope(Profiler* profiler);
+
+	/**
+	 * \brief Instrument \a ctc (if the profiler is not NULL).
+	 */
+	void add(Ctc& ctc);
+
+	/**
+	 * \brief Restore all the contractors.
+	 */
+	~CtcProfilerScope();
+
+private:
+	Profiler* profiler;
+	std::vector<Ctc*> ctcs;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CTC_PROFILER_H__
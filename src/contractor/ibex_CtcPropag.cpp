@@ -13,14 +13,16 @@
 #include "ibex_Cell.h"
 #include "ibex_Bsc.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace ibex {
 
 CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  active(BitSet::empty(cl.size())) {
+		  accumulate(false), priority(false), g(cl.size(), nb_var), agenda(cl.size()),
+		  active(BitSet::empty(cl.size())), prio_agenda(cl.size()) {
 
 	assert(check_nb_var_ctc_list(cl));
 
@@ -30,6 +32,8 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
 		}
 
+	g.build();
+
 	//cout << g << endl;
 }
 
@@ -47,6 +51,11 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 	assert(box.size()==nb_var);
 
+	if (priority) {
+		priority_contract(box, context);
+		return;
+	}
+
 	if (incremental) {
 		/**
 		 * Note: when context.impact() is NULL, we can
@@ -59,8 +68,8 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (context.impact[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
+				DirectedHyperGraph::Range ctrs=g.output_ctrs(i);
+				for (const int* c=ctrs.begin(); c!=ctrs.end(); c++)
 					agenda.push(*c);
 			}
 		}
@@ -77,10 +86,10 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	 *
 	 * When we call a contractor, we assume all
 	 * its variables have been impacted although there might be
-	 * only one of them impacted. In a future version, we may
-	 * consider a more fine propagation where the information
-	 * about the variables that are actually impacted is
-	 * given to the awaken contractor.
+	 * only one of them impacted. See #priority_contract for
+	 * a finer propagation where the information about the
+	 * variables that are actually impacted is given to the
+	 * awaken contractor.
 	 */
 	context.impact.fill(0,nb_var-1);
 
@@ -107,12 +116,12 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		agenda.pop(c);
 
-		set<int> vars=g.output_vars(c);
+		DirectedHyperGraph::Range vars=g.output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
+			for (const int* v=vars.begin(); v!=vars.end(); v++) {
 				old_box[*v] = box[*v];
 			}
 		}
@@ -135,13 +144,13 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
+		for (const int* it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+				DirectedHyperGraph::Range ctrs=g.output_ctrs(v);
+				for (const int* c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
 					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT]))
 						agenda.push(*c2);
 				}
@@ -173,4 +182,95 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 		context.output_flags.add(INACTIVE);
 }
 
+void CtcPropag::priority_contract(IntervalVector& box, ContractContext& context) {
+
+	// allocated on first call only
+	if (pending.empty()) {
+		pending.assign(list.size(), BitSet::empty(nb_var));
+		cost.resize(list.size());
+		for (int i=0; i<list.size(); i++)
+			cost[i]=std::max(1, g.input_vars(i).size());
+	}
+
+	if (incremental) {
+		for (int i=0; i<nb_var; i++) {
+			if (context.impact[i]) {
+				DirectedHyperGraph::Range ctrs=g.output_ctrs(i);
+				for (const int* c=ctrs.begin(); c!=ctrs.end(); c++) {
+					prio_agenda.push(*c, 1.0/cost[*c]);
+					pending[*c].add(i);
+				}
+			}
+		}
+	} else {
+		for (int i=0; i<list.size(); i++) {
+			prio_agenda.push(i, 1.0/cost[i]);
+			pending[i].fill(0,nb_var-1);
+		}
+	}
+
+	active.fill(0,list.size()-1);
+
+	int c; // current contractor
+
+	// see CtcPropag::contract(IntervalVector&, ContractContext&)
+	IntervalVector old_box(box);
+
+	while (!prio_agenda.empty()) {
+
+		prio_agenda.pop(c);
+
+		DirectedHyperGraph::Range vars=g.output_vars(c);
+
+		if (!accumulate) {
+			for (const int* v=vars.begin(); v!=vars.end(); v++) {
+				old_box[*v] = box[*v];
+			}
+		}
+
+		// only the variables that have changed since
+		// the last call to c are marked as impacted
+		context.impact = pending[c];
+		pending[c].clear();
+
+		context.output_flags.clear();
+
+		list[c].contract(box, context);
+
+		if (box.is_empty()) {
+			while (!prio_agenda.empty()) {
+				prio_agenda.pop(c);
+				pending[c].clear();
+			}
+			context.impact.fill(0,nb_var-1);
+			return;
+		}
+
+		if (context.output_flags[INACTIVE]) {
+			active.remove(c);
+		}
+
+		for (const int* it=vars.begin(); it!=vars.end(); it++) {
+			int v=*it;
+			if (old_box[v].ratiodelta(box[v])>=ratio) {
+				DirectedHyperGraph::Range ctrs=g.output_ctrs(v);
+				for (const int* c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT])) {
+						prio_agenda.push(*c2, 1.0/cost[*c2]);
+						pending[*c2].add(v);
+					}
+				}
+				if (accumulate)
+					old_box[v] = box[v];
+			}
+		}
+	}
+
+	context.impact.fill(0,nb_var-1); // re-init
+	context.output_flags.clear();
+
+	if (active.empty())
+		context.output_flags.add(INACTIVE);
+}
+
 } // namespace ibex
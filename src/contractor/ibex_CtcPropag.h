@@ -13,10 +13,13 @@
 #define __IBEX_CTC_PROPAG_H__
 
 #include "ibex_Agenda.h"
+#include "ibex_PriorityAgenda.h"
 #include "ibex_Ctc.h"
 #include "ibex_DirectedHyperGraph.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -81,6 +84,18 @@ public:
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/**
+	 * Priority-driven propagation? (default: false)
+	 *
+	 * If true, the agenda is ordered by the cost of the contractors
+	 * (the number of their input variables) instead of FIFO: cheap
+	 * contractors are called first and expensive ones are delayed until
+	 * the cheap ones have nothing more to propagate. Furthermore, each
+	 * contractor is called with the impact set to the variables that
+	 * have actually changed since its last call (instead of all).
+	 */
+	bool priority;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static constexpr double default_ratio = 0.01;
 
@@ -92,6 +107,16 @@ protected:
 
 	BitSet active;      // mark active sub-contractors
 
+	/**
+	 * Propagation with the priority agenda (see #priority).
+	 */
+	void priority_contract(IntervalVector& box, ContractContext& context);
+
+	PriorityAgenda prio_agenda;  // agenda used in "priority" mode
+
+	std::vector<BitSet> pending; // pending[c]: variables changed since the last call to c
+
+	std::vector<double> cost;    // cost[c]: number of input variables of c (at least 1)
 
 };
 
@@ -81,6 +81,14 @@ void CovList::add(const IntervalVector& x) {
 	data->vec.push_back(&data->lst.back());
 }
 
+void CovList::add(IntervalVector&& x) {
+	if (n!=(size_t) x.size())
+		ibex_error("[CovList] boxes must have all the same size.");
+
+	data->lst.push_back(std::move(x));
+	data->vec.push_back(&data->lst.back());
+}
+
 ostream& operator<<(ostream& os, const CovList& cov) {
 
 	for (size_t i=0; i<cov.size(); i++) {
@@ -124,7 +132,8 @@ ifstream* CovList::read(const char* filename, CovList& cov, std::stack<unsigned
 	size_t size = read_pos_int(*f);
 
 	for (unsigned int i=0; i<size; i++) {
-		cov.CovList::add(read_box(*f, cov.n));
+		// the box is moved (and the sub-classes read their own data)
+		cov.add(read_box(*f, cov.n));
 	}
 
 	return f;
@@ -83,6 +83,14 @@ public:
 	static const unsigned int FORMAT_VERSION;
 
 protected:
+	/**
+	 * \brief Add a new box at the end of the list (the box is moved).
+	 *
+	 * Only appends the box to the list: unlike add(const IntervalVector&),
+	 * this function is not virtual and is not overridden by sub-classes.
+	 */
+	void add(IntervalVector&& x);
+
 	/**
 	 * \brief Load a list from a COV file.
 	 */
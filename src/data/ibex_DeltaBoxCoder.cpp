@@ -0,0 +1,84 @@
+/* ============================================================================
+ * I B E X - Delta encoding of a sequence of boxes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_DeltaBoxCoder.h"
+
+#include <cstring>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+DeltaBoxCoder::DeltaBoxCoder(int n) : n(n), prev(new double[2*n]), first(true) {
+	assert(n>0);
+}
+
+DeltaBoxCoder::~DeltaBoxCoder() {
+	delete[] prev;
+}
+
+void DeltaBoxCoder::reset() {
+	first=true;
+}
+
+int DeltaBoxCoder::encode(const IntervalVector& box, unsigned char* buf) {
+	assert(box.size()==n);
+
+	unsigned char* mask=buf;
+	memset(mask, 0, mask_size());
+	unsigned char* p=buf+mask_size();
+
+	if (box.is_empty()) {
+		// the previous box is unchanged
+		mask[(2*n)/8] |= 1 << ((2*n)%8);
+		return p-buf;
+	}
+
+	for (int k=0; k<2*n; k++) {
+		double x = k%2==0 ? box[k/2].lb() : box[k/2].ub();
+		if (first || memcmp(&x, &prev[k], sizeof(double))!=0) {
+			mask[k/8] |= 1 << (k%8);
+			memcpy(p, &x, sizeof(double));
+			p+=sizeof(double);
+			prev[k]=x;
+		}
+	}
+	first=false;
+
+	return p-buf;
+}
+
+int DeltaBoxCoder::decode(const unsigned char* buf, IntervalVector& box) {
+	assert(box.size()==n);
+
+	const unsigned char* mask=buf;
+	const unsigned char* p=buf+mask_size();
+
+	if (mask[(2*n)/8] & (1 << ((2*n)%8))) {
+		box.set_empty();
+		return p-buf;
+	}
+
+	for (int k=0; k<2*n; k++) {
+		if (mask[k/8] & (1 << (k%8))) {
+			memcpy(&prev[k], p, sizeof(double));
+			p+=sizeof(double);
+		} else
+			assert(!first);
+	}
+	first=false;
+
+	for (int i=0; i<n; i++)
+		box[i]=Interval(prev[2*i],prev[2*i+1]);
+
+	return p-buf;
+}
+
+} // namespace ibex
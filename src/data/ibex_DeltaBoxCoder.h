@@ -0,0 +1,107 @@
+/* ============================================================================
+ * I B E X - Delta encoding of a sequence of boxes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_DELTA_BOX_CODER_H__
+#define __IBEX_DELTA_BOX_CODER_H__
+
+#include "ibex_IntervalVector.h"
+
+namespace ibex {
+
+/**
+ * \ingroup data
+ *
+ * \brief Compact (lossless) encoding of a sequence of boxes.
+ *
+ * Each box is encoded as a difference with the previous box of
+ * the sequence: only the bounds that have changed are stored.
+ * Consecutive boxes in a search often differ in a few bounds
+ * only (e.g., the two halves of a bisected box differ in one
+ * bound), so that the encoding of a box is usually much smaller
+ * than 2n doubles.
+ *
+ * The encoded form of a box is a bitset of 2n+1 bits (one bit per bound,
+ * set if the bound is stored, plus one bit for the empty box), followed
+ * by the stored bounds (doubles, in the order lb(x1), ub(x1),...).
+ * The bounds are compared bitwise, so that decoding gives exactly the
+ * same box.
+ *
+ * The boxes must be decoded in the same order as they have been
+ * encoded, by another coder (in the same initial state).
+ */
+class DeltaBoxCoder {
+public:
+	/**
+	 * \brief Create a coder for boxes of size n.
+	 */
+	explicit DeltaBoxCoder(int n);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~DeltaBoxCoder();
+
+	/**
+	 * \brief Forget the previous box.
+	 *
+	 * The next box will be fully stored.
+	 */
+	void reset();
+
+	/**
+	 * \brief Maximal number of bytes of an encoded box.
+	 */
+	int max_size() const;
+
+	/**
+	 * \brief Encode a box.
+	 *
+	 * \param buf - array of at least #max_size() bytes.
+	 * \return      the number of bytes written in \a buf.
+	 */
+	int encode(const IntervalVector& box, unsigned char* buf);
+
+	/**
+	 * \brief Decode a box.
+	 *
+	 * \param buf - encoded box.
+	 * \param box - (output) the box (of size n).
+	 * \return      the number of bytes read in \a buf.
+	 */
+	int decode(const unsigned char* buf, IntervalVector& box);
+
+	/**
+	 * \brief Size of the boxes.
+	 */
+	const int n;
+
+private:
+	/* size in bytes of the bitset */
+	int mask_size() const;
+
+	/* bounds of the previous box */
+	double* prev;
+
+	/* true if no box has been encoded (or decoded) since the last reset */
+	bool first;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int DeltaBoxCoder::mask_size() const {
+	return (2*n+1+7)/8;
+}
+
+inline int DeltaBoxCoder::max_size() const {
+	return mask_size()+2*n*sizeof(double);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_DELTA_BOX_CODER_H__
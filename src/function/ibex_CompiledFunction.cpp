@@ -19,7 +19,8 @@ using namespace std;
 
 namespace ibex {
 
-CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL), nb_args(NULL), args(NULL), ptr(-1) {
+CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL), nb_args(NULL), args(NULL), ptr(-1),
+		tape(NULL), tape_cst(NULL), nb_tape_vars(0), tape_var(NULL), tape_var_pos(NULL) {
 
 }
 
@@ -37,6 +38,108 @@ void CompiledFunction::compile(Function& f) {
 		(*nodes)[ptr].accept_visitor(*this);
 	}
 	//cout << f.name << " : n=" << n << " nb_args[" << 0 << "]=" << nb_args[0] << endl;
+
+	compile_tape(f);
+}
+
+void CompiledFunction::compile_tape(Function& f) {
+
+	if (!f.expr().dim.is_scalar()) return;
+
+	// first variable index of each symbol
+	int* symbol_index=new int[f.nb_arg()];
+	for (int j=0, k=0; j<f.nb_arg(); k+=f.arg(j).dim.size(), j++)
+		symbol_index[f.arg(j).key]=k;
+
+	// variable index of each scalar leaf (-1 otherwise)
+	int* var=new int[n];
+	bool scalar_only=true;
+
+	for (int i=0; i<n && scalar_only; i++) {
+		const ExprNode& e=(*nodes)[i];
+		var[i]=-1;
+		switch (code[i]) {
+		case SYM:
+			if (e.dim.is_scalar())
+				var[i]=symbol_index[((const ExprSymbol&) e).key];
+			break;
+		case IDX:
+		case IDX_CP: {
+			const ExprIndex& idx=(const ExprIndex&) e;
+			const ExprSymbol* x=dynamic_cast<const ExprSymbol*>(&idx.expr);
+			if (x && e.dim.is_scalar())
+				var[i]=symbol_index[x->key]+idx.index.first_row()*x->dim.nb_cols()+idx.index.first_col();
+			else
+				scalar_only=false;
+			break;
+		}
+		case VEC: case APPLY: case GEN1: case GEN2:
+		case MINUS_V: case MINUS_M: case TRANS_V: case TRANS_M:
+		case ADD_V: case ADD_M: case SUB_V: case SUB_M:
+		case MUL_SV: case MUL_SM: case MUL_VV: case MUL_MV: case MUL_MM: case MUL_VM:
+			scalar_only=false;
+			break;
+		default:
+			scalar_only=e.dim.is_scalar();
+		}
+	}
+
+	if (scalar_only) {
+		// all the occurrences of a variable share the same tape position
+		int* var_pos=new int[f.nb_var()];
+		for (int k=0; k<f.nb_var(); k++) var_pos[k]=-1;
+
+		int* pos=new int[n];
+		for (int i=0; i<n; i++) {
+			if (var[i]==-1)
+				pos[i]=i;
+			else {
+				if (var_pos[var[i]]==-1) {
+					var_pos[var[i]]=i;
+					nb_tape_vars++;
+				}
+				pos[i]=var_pos[var[i]];
+			}
+		}
+
+		tape=new TapeInstr[n];
+		vector<const Interval*> cst;
+
+		for (int i=0; i<n; i++) {
+			TapeInstr& t=tape[i];
+			t.code=code[i];
+			t.x1=t.x2=t.x3=-1;
+			switch (code[i]) {
+			case SYM:
+			case IDX:
+			case IDX_CP: if (var[i]!=-1 && pos[i]==i) t.x1=var[i]; break;
+			case CST:    t.x1=cst.size(); cst.push_back(&((const ExprConstant&) (*nodes)[i]).get_value()); break;
+			case POWER:  t.x1=pos[args[i][0]]; t.x2=((const ExprPower&) (*nodes)[i]).expon; break;
+			default:
+				t.x1=pos[args[i][0]];
+				if (nb_args[i]>1) t.x2=pos[args[i][1]];
+				if (nb_args[i]>2) t.x3=pos[args[i][2]];
+			}
+		}
+
+		tape_cst=new const Interval*[cst.size()];
+		for (size_t j=0; j<cst.size(); j++) tape_cst[j]=cst[j];
+
+		tape_var=new int[nb_tape_vars];
+		tape_var_pos=new int[nb_tape_vars];
+		for (int k=0, j=0; k<f.nb_var(); k++) {
+			if (var_pos[k]!=-1) {
+				tape_var[j]=k;
+				tape_var_pos[j++]=var_pos[k];
+			}
+		}
+
+		delete[] pos;
+		delete[] var_pos;
+	}
+
+	delete[] var;
+	delete[] symbol_index;
 }
 
 CompiledFunction::~CompiledFunction() {
@@ -46,6 +149,300 @@ CompiledFunction::~CompiledFunction() {
 	for (int i=0; i<n; i++) delete[] args[i];
 	delete[] args;
 	delete[] nb_args;
+
+	if (tape) {
+		delete[] tape;
+		delete[] tape_cst;
+		delete[] tape_var;
+		delete[] tape_var_pos;
+	}
+}
+
+// Forward evaluation of a non-leaf instruction
+inline bool CompiledFunction::tape_forward(const TapeInstr& t, const Interval* d, Interval& y) const {
+	switch(t.code) {
+	case CHI:    y=chi(d[t.x1],d[t.x2],d[t.x3]); break;
+	case ADD:    y=d[t.x1]+d[t.x2]; break;
+	case MUL:    y=d[t.x1]*d[t.x2]; break;
+	case SUB:    y=d[t.x1]-d[t.x2]; break;
+	case DIV:    y=d[t.x1]/d[t.x2]; break;
+	case MAX:    y=max(d[t.x1],d[t.x2]); break;
+	case MIN:    y=min(d[t.x1],d[t.x2]); break;
+	case ATAN2:  y=atan2(d[t.x1],d[t.x2]); break;
+	case MINUS:  y=-d[t.x1]; break;
+	case SIGN:   y=sign(d[t.x1]); break;
+	case ABS:    y=abs(d[t.x1]); break;
+	case POWER:  y=pow(d[t.x1],t.x2); break;
+	case SQR:    y=sqr(d[t.x1]); break;
+	case SQRT:   if ((y=sqrt(d[t.x1])).is_empty()) return false; break;
+	case EXP:    y=exp(d[t.x1]); break;
+	case LOG:    if ((y=log(d[t.x1])).is_empty()) return false; break;
+	case COS:    y=cos(d[t.x1]); break;
+	case SIN:    y=sin(d[t.x1]); break;
+	case TAN:    if ((y=tan(d[t.x1])).is_empty()) return false; break;
+	case COSH:   y=cosh(d[t.x1]); break;
+	case SINH:   y=sinh(d[t.x1]); break;
+	case TANH:   y=tanh(d[t.x1]); break;
+	case ACOS:   if ((y=acos(d[t.x1])).is_empty()) return false; break;
+	case ASIN:   if ((y=asin(d[t.x1])).is_empty()) return false; break;
+	case ATAN:   y=atan(d[t.x1]); break;
+	case ACOSH:  if ((y=acosh(d[t.x1])).is_empty()) return false; break;
+	case ASINH:  y=asinh(d[t.x1]); break;
+	case ATANH:  if ((y=atanh(d[t.x1])).is_empty()) return false; break;
+	case FLOOR:  if ((y=floor(d[t.x1])).is_empty()) return false; break;
+	case CEIL:   if ((y=ceil(d[t.x1])).is_empty()) return false; break;
+	case SAW:    if ((y=saw(d[t.x1])).is_empty()) return false; break;
+	default:     assert(false);
+	}
+	return true;
+}
+
+// Backward projection of a non-leaf instruction
+inline bool CompiledFunction::tape_backward(const TapeInstr& t, const Interval& y, Interval* d) const {
+	switch(t.code) {
+	case CHI:    return bwd_chi(y,d[t.x1],d[t.x2],d[t.x3]);
+	case ADD:    return bwd_add(y,d[t.x1],d[t.x2]);
+	case MUL:    return bwd_mul(y,d[t.x1],d[t.x2]);
+	case SUB:    return bwd_sub(y,d[t.x1],d[t.x2]);
+	case DIV:    return bwd_div(y,d[t.x1],d[t.x2]);
+	case MAX:    return bwd_max(y,d[t.x1],d[t.x2]);
+	case MIN:    return bwd_min(y,d[t.x1],d[t.x2]);
+	case ATAN2:  return bwd_atan2(y,d[t.x1],d[t.x2]);
+	case MINUS:  return !(d[t.x1] &= -y).is_empty();
+	case SIGN:   return bwd_sign(y,d[t.x1]);
+	case ABS:    return bwd_abs(y,d[t.x1]);
+	case POWER:  return bwd_pow(y,t.x2,d[t.x1]);
+	case SQR:    return bwd_sqr(y,d[t.x1]);
+	case SQRT:   return bwd_sqrt(y,d[t.x1]);
+	case EXP:    return bwd_exp(y,d[t.x1]);
+	case LOG:    return bwd_log(y,d[t.x1]);
+	case COS:    return bwd_cos(y,d[t.x1]);
+	case SIN:    return bwd_sin(y,d[t.x1]);
+	case TAN:    return bwd_tan(y,d[t.x1]);
+	case COSH:   return bwd_cosh(y,d[t.x1]);
+	case SINH:   return bwd_sinh(y,d[t.x1]);
+	case TANH:   return bwd_tanh(y,d[t.x1]);
+	case ACOS:   return bwd_acos(y,d[t.x1]);
+	case ASIN:   return bwd_asin(y,d[t.x1]);
+	case ATAN:   return bwd_atan(y,d[t.x1]);
+	case ACOSH:  return bwd_acosh(y,d[t.x1]);
+	case ASINH:  return bwd_asinh(y,d[t.x1]);
+	case ATANH:  return bwd_atanh(y,d[t.x1]);
+	case FLOOR:  return bwd_floor(y,d[t.x1]);
+	case CEIL:   return bwd_ceil(y,d[t.x1]);
+	case SAW:    return bwd_saw(y,d[t.x1]);
+	default:     assert(false); return false;
+	}
+}
+
+bool CompiledFunction::tape_forward(const IntervalVector& box, Interval* d) const {
+
+	for (int i=n-1; i>=0; i--) {
+		const TapeInstr& t=tape[i];
+		switch(t.code) {
+		case SYM:
+		case IDX:
+		case IDX_CP: if (t.x1!=-1) d[i]=box[t.x1]; break;
+		case CST:    d[i]=*tape_cst[t.x1]; break;
+		default:     if (!tape_forward(t,d,d[i])) return false;
+		}
+	}
+	return true;
+}
+
+bool CompiledFunction::tape_forward(const IntervalVector& box, Interval* d, bool* dirty) const {
+
+	for (int i=n-1; i>=0; i--) {
+		const TapeInstr& t=tape[i];
+		switch(t.code) {
+		case SYM:
+		case IDX:
+		case IDX_CP:
+			dirty[i]=t.x1!=-1 && d[i]!=box[t.x1];
+			if (dirty[i]) d[i]=box[t.x1];
+			break;
+		case CST:
+			dirty[i]=d[i]!=*tape_cst[t.x1];
+			if (dirty[i]) d[i]=*tape_cst[t.x1];
+			break;
+		default:
+			// note: for POWER, x2 is the exponent
+			dirty[i]=dirty[t.x1] || (t.x2!=-1 && t.code!=POWER && dirty[t.x2]) || (t.x3!=-1 && dirty[t.x3]);
+			if (dirty[i] && !tape_forward(t,d,d[i])) return false;
+		}
+	}
+	return true;
+}
+
+bool CompiledFunction::tape_backward(Interval* d) const {
+
+	for (int i=0; i<n; i++) {
+		const TapeInstr& t=tape[i];
+		switch(t.code) {
+		case SYM:
+		case IDX:
+		case IDX_CP:
+		case CST:    break;
+		default:     if (!tape_backward(t,d[i],d)) return false;
+		}
+	}
+	return true;
+}
+
+bool CompiledFunction::tape_backward(Interval* d, const Interval* fwd) const {
+
+	for (int i=0; i<n; i++) {
+		const TapeInstr& t=tape[i];
+		switch(t.code) {
+		case SYM:
+		case IDX:
+		case IDX_CP:
+		case CST:
+			break;
+		case ADD: case SUB: case MUL: case MINUS: case ABS: case MAX: case MIN:
+		case SQR: case EXP: case COS: case SIN: case ATAN:
+		case COSH: case SINH: case TANH: case ASINH:
+			// operators defined everywhere: the projection of
+			// an unchanged image cannot contract the arguments
+			if (d[i]==fwd[i]) break;
+			if (!tape_backward(t,d[i],d)) return false;
+			break;
+		default:
+			if (!tape_backward(t,d[i],d)) return false;
+		}
+	}
+	return true;
+}
+
+void CompiledFunction::tape_read(const Interval* d, IntervalVector& box) const {
+	for (int k=0; k<nb_tape_vars; k++)
+		box[tape_var[k]]=d[tape_var_pos[k]];
+}
+
+// Loop of a batch instruction over the N boxes.
+// y, x1, x2 and x3 are the domains of the node and its arguments
+// for the first box (arrays of N consecutive intervals).
+#define _BATCH(instr) for (int j=0; j<N; j++) { instr; } break;
+
+void CompiledFunction::tape_forward_batch(const IntervalMatrix& boxes, Interval* d, bool* ok) const {
+
+	int N=boxes.nb_cols();
+
+	for (int i=n-1; i>=0; i--) {
+		const TapeInstr& t=tape[i];
+		Interval* y=d+i*N;
+		bool leaf=(t.code==SYM || t.code==IDX || t.code==IDX_CP || t.code==CST);
+		Interval* x1=leaf? NULL : d+t.x1*N;
+		Interval* x2=t.x2==-1 || t.code==POWER? NULL : d+t.x2*N;
+		Interval* x3=t.x3==-1? NULL : d+t.x3*N;
+		switch(t.code) {
+		case SYM:
+		case IDX:
+		case IDX_CP: if (t.x1==-1) break;
+		             _BATCH(y[j]=boxes[t.x1][j])
+		case CST:    _BATCH(y[j]=*tape_cst[t.x1])
+		case CHI:    _BATCH(y[j]=chi(x1[j],x2[j],x3[j]))
+		case ADD:    _BATCH(y[j]=x1[j]+x2[j])
+		case MUL:    _BATCH(y[j]=x1[j]*x2[j])
+		case SUB:    _BATCH(y[j]=x1[j]-x2[j])
+		case DIV:    _BATCH(y[j]=x1[j]/x2[j])
+		case MAX:    _BATCH(y[j]=max(x1[j],x2[j]))
+		case MIN:    _BATCH(y[j]=min(x1[j],x2[j]))
+		case ATAN2:  _BATCH(y[j]=atan2(x1[j],x2[j]))
+		case MINUS:  _BATCH(y[j]=-x1[j])
+		case SIGN:   _BATCH(y[j]=sign(x1[j]))
+		case ABS:    _BATCH(y[j]=abs(x1[j]))
+		case POWER:  _BATCH(y[j]=pow(x1[j],t.x2))
+		case SQR:    _BATCH(y[j]=sqr(x1[j]))
+		case SQRT:   _BATCH(if ((y[j]=sqrt(x1[j])).is_empty()) ok[j]=false)
+		case EXP:    _BATCH(y[j]=exp(x1[j]))
+		case LOG:    _BATCH(if ((y[j]=log(x1[j])).is_empty()) ok[j]=false)
+		case COS:    _BATCH(y[j]=cos(x1[j]))
+		case SIN:    _BATCH(y[j]=sin(x1[j]))
+		case TAN:    _BATCH(if ((y[j]=tan(x1[j])).is_empty()) ok[j]=false)
+		case COSH:   _BATCH(y[j]=cosh(x1[j]))
+		case SINH:   _BATCH(y[j]=sinh(x1[j]))
+		case TANH:   _BATCH(y[j]=tanh(x1[j]))
+		case ACOS:   _BATCH(if ((y[j]=acos(x1[j])).is_empty()) ok[j]=false)
+		case ASIN:   _BATCH(if ((y[j]=asin(x1[j])).is_empty()) ok[j]=false)
+		case ATAN:   _BATCH(y[j]=atan(x1[j]))
+		case ACOSH:  _BATCH(if ((y[j]=acosh(x1[j])).is_empty()) ok[j]=false)
+		case ASINH:  _BATCH(y[j]=asinh(x1[j]))
+		case ATANH:  _BATCH(if ((y[j]=atanh(x1[j])).is_empty()) ok[j]=false)
+		case FLOOR:  _BATCH(if ((y[j]=floor(x1[j])).is_empty()) ok[j]=false)
+		case CEIL:   _BATCH(if ((y[j]=ceil(x1[j])).is_empty()) ok[j]=false)
+		case SAW:    _BATCH(if ((y[j]=saw(x1[j])).is_empty()) ok[j]=false)
+		default:     assert(false);
+		}
+	}
+}
+
+void CompiledFunction::tape_backward_batch(int N, Interval* d, bool* ok) const {
+
+	for (int i=0; i<n; i++) {
+		const TapeInstr& t=tape[i];
+		const Interval* y=d+i*N;
+		bool leaf=(t.code==SYM || t.code==IDX || t.code==IDX_CP || t.code==CST);
+		Interval* x1=leaf? NULL : d+t.x1*N;
+		Interval* x2=t.x2==-1 || t.code==POWER? NULL : d+t.x2*N;
+		Interval* x3=t.x3==-1? NULL : d+t.x3*N;
+		switch(t.code) {
+		case SYM:
+		case IDX:
+		case IDX_CP:
+		case CST:    break;
+		case CHI:    _BATCH(ok[j] &= bwd_chi(y[j],x1[j],x2[j],x3[j]))
+		case ADD:    _BATCH(ok[j] &= bwd_add(y[j],x1[j],x2[j]))
+		case MUL:    _BATCH(ok[j] &= bwd_mul(y[j],x1[j],x2[j]))
+		case SUB:    _BATCH(ok[j] &= bwd_sub(y[j],x1[j],x2[j]))
+		case DIV:    _BATCH(ok[j] &= bwd_div(y[j],x1[j],x2[j]))
+		case MAX:    _BATCH(ok[j] &= bwd_max(y[j],x1[j],x2[j]))
+		case MIN:    _BATCH(ok[j] &= bwd_min(y[j],x1[j],x2[j]))
+		case ATAN2:  _BATCH(ok[j] &= bwd_atan2(y[j],x1[j],x2[j]))
+		case MINUS:  _BATCH(ok[j] &= !(x1[j] &= -y[j]).is_empty())
+		case SIGN:   _BATCH(ok[j] &= bwd_sign(y[j],x1[j]))
+		case ABS:    _BATCH(ok[j] &= bwd_abs(y[j],x1[j]))
+		case POWER:  _BATCH(ok[j] &= bwd_pow(y[j],t.x2,x1[j]))
+		case SQR:    _BATCH(ok[j] &= bwd_sqr(y[j],x1[j]))
+		case SQRT:   _BATCH(ok[j] &= bwd_sqrt(y[j],x1[j]))
+		case EXP:    _BATCH(ok[j] &= bwd_exp(y[j],x1[j]))
+		case LOG:    _BATCH(ok[j] &= bwd_log(y[j],x1[j]))
+		case COS:    _BATCH(ok[j] &= bwd_cos(y[j],x1[j]))
+		case SIN:    _BATCH(ok[j] &= bwd_sin(y[j],x1[j]))
+		case TAN:    _BATCH(ok[j] &= bwd_tan(y[j],x1[j]))
+		case COSH:   _BATCH(ok[j] &= bwd_cosh(y[j],x1[j]))
+		case SINH:   _BATCH(ok[j] &= bwd_sinh(y[j],x1[j]))
+		case TANH:   _BATCH(ok[j] &= bwd_tanh(y[j],x1[j]))
+		case ACOS:   _BATCH(ok[j] &= bwd_acos(y[j],x1[j]))
+		case ASIN:   _BATCH(ok[j] &= bwd_asin(y[j],x1[j]))
+		case ATAN:   _BATCH(ok[j] &= bwd_atan(y[j],x1[j]))
+		case ACOSH:  _BATCH(ok[j] &= bwd_acosh(y[j],x1[j]))
+		case ASINH:  _BATCH(ok[j] &= bwd_asinh(y[j],x1[j]))
+		case ATANH:  _BATCH(ok[j] &= bwd_atanh(y[j],x1[j]))
+		case FLOOR:  _BATCH(ok[j] &= bwd_floor(y[j],x1[j]))
+		case CEIL:   _BATCH(ok[j] &= bwd_ceil(y[j],x1[j]))
+		case SAW:    _BATCH(ok[j] &= bwd_saw(y[j],x1[j]))
+		default:     assert(false);
+		}
+	}
+}
+
+#undef _BATCH
+
+void CompiledFunction::tape_read_batch(const Interval* d, const bool* ok, IntervalMatrix& boxes) const {
+	int N=boxes.nb_cols();
+
+	for (int k=0; k<nb_tape_vars; k++) {
+		IntervalVector& row=boxes[tape_var[k]];
+		const Interval* x=d+tape_var_pos[k]*N;
+		for (int j=0; j<N; j++)
+			if (ok[j]) row[j]=x[j];
+	}
+
+	for (int j=0; j<N; j++)
+		if (!ok[j])
+			for (int k=0; k<boxes.nb_rows(); k++)
+				boxes[k][j].set_empty();
 }
 
 Agenda* CompiledFunction::agenda(int rank) const {
@@ -83,6 +83,120 @@ public:
 	 */
 	Agenda* agenda(int rank) const;
 
+	/**
+	 * \brief True if the function has a compact tape.
+	 *
+	 * The tape is only built for scalar-only functions, i.e., real-valued
+	 * functions with only scalar nodes, except symbols (vector or matrix
+	 * symbols are allowed if only accessed through scalar components)
+	 * and with no function application or generic operator.
+	 *
+	 * The domains of the nodes are then stored in a contiguous array
+	 * indexed by tape position (see #tape_size()), and the
+	 * forward/backward phases run directly on intervals.
+	 */
+	bool has_tape() const;
+
+	/**
+	 * \brief Size of the array of domains required by the tape.
+	 */
+	int tape_size() const;
+
+	/**
+	 * \brief Forward phase on the tape.
+	 *
+	 * Set d[0] to the image of the box (root node).
+	 *
+	 * \param d - the domains of the nodes (array of size #tape_size()).
+	 * \return false if the box is outside the definition domain
+	 *         of the function.
+	 * \pre has_tape().
+	 */
+	bool tape_forward(const IntervalVector& box, Interval* d) const;
+
+	/**
+	 * \brief Backward phase on the tape.
+	 *
+	 * The domains must be those computed by tape_forward(...) and
+	 * d[0] (the root) can be contracted in-between.
+	 *
+	 * \return false if an empty domain is found.
+	 * \pre has_tape().
+	 */
+	bool tape_backward(Interval* d) const;
+
+	/**
+	 * \brief Incremental forward phase on the tape.
+	 *
+	 * The array \a d must contain the domains computed by the last
+	 * (successful) forward phase. Only the nodes that depend on a
+	 * variable (or a constant) whose domain has changed since are
+	 * recomputed; dirty[i] is set to true iff the ith node has been
+	 * recomputed. The result is the same as with
+	 * #tape_forward(const IntervalVector&, Interval*) const.
+	 *
+	 * \param dirty - array of size #tape_size().
+	 * \return false if the box is outside the definition domain
+	 *         of the function (the domains in d are then invalid).
+	 * \pre has_tape().
+	 */
+	bool tape_forward(const IntervalVector& box, Interval* d, bool* dirty) const;
+
+	/**
+	 * \brief Backward phase on the tape, skipping unchanged nodes.
+	 *
+	 * Same as #tape_backward(Interval*) const, where \a fwd are the
+	 * domains computed by the forward phase (i.e., d before the root
+	 * is contracted). The projection of a node whose domain has not been
+	 * contracted (d[i]==fwd[i]) is skipped, unless the operator is
+	 * not defined everywhere (e.g., sqrt or log).
+	 *
+	 * \pre has_tape().
+	 */
+	bool tape_backward(Interval* d, const Interval* fwd) const;
+
+	/**
+	 * \brief Write the domains of the variables into the box.
+	 *
+	 * \pre has_tape().
+	 */
+	void tape_read(const Interval* d, IntervalVector& box) const;
+
+	/**
+	 * \brief Forward phase on the tape, for N boxes at once.
+	 *
+	 * Each instruction is run over the N boxes before moving
+	 * to the next instruction.
+	 *
+	 * \param boxes - the boxes in structure-of-arrays layout
+	 *                (the jth column is the jth box, N=boxes.nb_cols()).
+	 * \param d     - the domains of the nodes, tape position-major
+	 *                (array of size #tape_size()*N): d[i*N+j] is the
+	 *                domain of the ith node for the jth box.
+	 * \param ok    - (array of size N) ok[j] is set to false if the jth
+	 *                box is outside the definition domain (left unchanged
+	 *                otherwise).
+	 * \pre has_tape().
+	 */
+	void tape_forward_batch(const IntervalMatrix& boxes, Interval* d, bool* ok) const;
+
+	/**
+	 * \brief Backward phase on the tape, for N boxes at once.
+	 *
+	 * \see #tape_forward_batch(const IntervalMatrix&, Interval*, bool*).
+	 * ok[j] is set to false if an empty domain is found for the jth box.
+	 * \pre has_tape().
+	 */
+	void tape_backward_batch(int N, Interval* d, bool* ok) const;
+
+	/**
+	 * \brief Write the domains of the variables into the boxes.
+	 *
+	 * The boxes j such that ok[j]==false are set to the empty set.
+	 * \pre has_tape().
+	 */
+	void tape_read_batch(const Interval* d, const bool* ok, IntervalMatrix& boxes) const;
+
 	/**
 	 * Print the structure to the standard output.
 	 */
@@ -171,6 +285,11 @@ private:
 
 	const char* op(operation o) const;
 
+	/**
+	 * Build the compact tape (if the function is scalar-only).
+	 */
+	void compile_tape(Function& f);
+
 	int n; // == the size of the root expression
 
 	int n_total; // == the size of the expression, including all arguments
@@ -186,10 +305,46 @@ private:
 	// Node counter in Polish prefix notation
 	// (only useful during construction)
 	mutable int ptr;
+
+	/*
+	 * Instruction of the compact tape. The arguments are tape positions,
+	 * except for leaves: x1 is the variable index (SYM, IDX) or the
+	 * constant index (CST). For POWER, x2 is the exponent. A symbol that
+	 * is not scalar is skipped (x1==-1).
+	 */
+	struct TapeInstr {
+		operation code;
+		int x1, x2, x3;
+	};
+
+	/*
+	 * Forward evaluation/backward projection of a
+	 * single (non-leaf) instruction of the tape.
+	 */
+	bool tape_forward(const TapeInstr& t, const Interval* d, Interval& y) const;
+	bool tape_backward(const TapeInstr& t, const Interval& y, Interval* d) const;
+
+	TapeInstr* tape; // NULL if the function is not scalar-only
+
+	const Interval** tape_cst; // values of the constants (may be mutable)
+
+	int nb_tape_vars;
+
+	int* tape_var; // the variables (indices in the box)
+
+	int* tape_var_pos; // tape position of each variable
 };
 
 std::ostream& operator<<(std::ostream& os, const CompiledFunction& data);
 
+inline bool CompiledFunction::has_tape() const {
+	return tape!=NULL;
+}
+
+inline int CompiledFunction::tape_size() const {
+	return n;
+}
+
 template<class V>
 inline void CompiledFunction::forward(const V& algo) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
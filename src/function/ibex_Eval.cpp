@@ -19,7 +19,8 @@ using namespace std;
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix_fwd_agenda(NULL), matrix_bwd_agenda(NULL) {
+Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix_fwd_agenda(NULL), matrix_bwd_agenda(NULL),
+		tape(f.cf.has_tape() ? new Interval[f.cf.tape_size()] : NULL), batch(NULL), batch_ok(NULL), batch_capacity(0) {
 
 	Dim dim=f.expr().dim;
 	int m=dim.vec_size();
@@ -66,6 +67,13 @@ Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix
 }
 
 Eval::~Eval() {
+	if (tape) delete[] tape;
+
+	if (batch) {
+		delete[] batch;
+		delete[] batch_ok;
+	}
+
 	if (fwd_agenda!=NULL) {
 		for (int i=0; i<f.expr().dim.vec_size(); i++) {
 			delete fwd_agenda[i];
@@ -89,6 +97,35 @@ Eval::~Eval() {
 	}
 }
 
+void Eval::reserve_batch(int N) {
+	if (N<=batch_capacity) return;
+
+	if (batch) {
+		delete[] batch;
+		delete[] batch_ok;
+	}
+
+	batch = new Interval[f.cf.tape_size()*N];
+	batch_ok = new bool[N];
+	batch_capacity = N;
+}
+
+void Eval::tape_eval_batch(const IntervalMatrix& boxes, IntervalVector& y) {
+	int N=boxes.nb_cols();
+
+	reserve_batch(N);
+	for (int j=0; j<N; j++) batch_ok[j]=true;
+
+	f.cf.tape_forward_batch(boxes, batch, batch_ok);
+
+	for (int j=0; j<N; j++) {
+		if (batch_ok[j])
+			y[j]=batch[j]; // root node
+		else
+			y[j].set_empty();
+	}
+}
+
 Domain& Eval::eval(const Array<const Domain>& d2) {
 
 	d.write_arg_domains(d2);
@@ -17,13 +17,73 @@
 #include "ibex_Gradient.h"
 #include "ibex_ExprFuncDomain.h"
 
+#ifndef _WIN32
+#include <unordered_map>
+#endif
+
 using namespace std;
 
 namespace ibex {
 
+#ifndef _WIN32
+/*
+ * Evaluators of a thread, indexed by function id.
+ * The table is only accessed by its thread (no lock). The entry
+ * of a destroyed function is not erased (the destructor may run
+ * in another thread) but, as ids are never reused, it is never
+ * looked up again.
+ */
+struct Function::EvaluatorTable {
+	unordered_map<long,Evaluators*> map;
+};
+
+Function::Evaluators& Function::thread_evaluators() const {
+	static thread_local shared_ptr<EvaluatorTable> table(new EvaluatorTable());
+
+	unordered_map<long,Evaluators*>::const_iterator it=table->map.find(_id);
+	if (it!=table->map.end()) return *it->second;
+
+	Evaluators* e=NULL;
+
+	{
+		// reuse the evaluators of a thread that is over
+		lock_guard<mutex> lock(_others_mtx);
+		for (vector<Evaluators*>::iterator it2=_others.begin(); it2!=_others.end(); ++it2) {
+			if ((*it2)->table.expired()) {
+				e=*it2;
+				e->table=table;
+				break;
+			}
+		}
+	}
+
+	if (!e) {
+		// note: building the evaluators may require the
+		// evaluators of other functions (hence no lock)
+		e=new Evaluators();
+		e->eval = new Eval((Function&) *this);
+		e->hc4revise = new HC4Revise(*e->eval);
+		e->grad = new Gradient(*e->eval);
+		e->inhc4revise = new InHC4Revise(*e->eval);
+		e->table = table;
+
+		lock_guard<mutex> lock(_others_mtx);
+		_others.push_back(e);
+	}
+
+	e->hc4revise->incremental = _hc4revise->incremental;
+	table->map[_id]=e;
+	return *e;
+}
+#endif
+
 const System& Function::def_domain() const {
+#ifndef _WIN32
+	call_once(_def_domain_flag, [this]() { (System*&) _def_domain = ExprFuncDomain(*this).get(); });
+#else
 	if (!_def_domain)
 		(System*&) _def_domain = ExprFuncDomain(*this).get();
+#endif
 	return *_def_domain;
 }
 
@@ -37,6 +97,16 @@ Function::~Function() {
 		delete _inhc4revise;
 	}
 
+#ifndef _WIN32
+	for (vector<Evaluators*>::iterator it=_others.begin(); it!=_others.end(); ++it) {
+		delete (*it)->eval;
+		delete (*it)->hc4revise;
+		delete (*it)->grad;
+		delete (*it)->inhc4revise;
+		delete *it;
+	}
+#endif
+
 	if (comp!=NULL) {
 		/* warning... if there is only one constraint
 		 * then comp[0] is the same object as f itself!
@@ -187,6 +257,34 @@ const ExprNode& Function::operator()(const Array<const ExprNode>& new_args) cons
 //const ExprApply& Function::operator()(const ExprNode& arg0, const Interval& arg1)       { return (*this)(arg0,_I(0,1)); }
 
 
+void Function::eval_batch(const IntervalMatrix& boxes, IntervalVector& y) const {
+	assert(_image_dim.is_scalar());
+	assert(boxes.nb_rows()==nb_var() && y.size()==boxes.nb_cols());
+
+	if (cf.has_tape())
+		basic_evaluator().tape_eval_batch(boxes, y);
+	else
+		for (int j=0; j<boxes.nb_cols(); j++)
+			y[j]=eval(boxes.col(j));
+}
+
+void Function::backward_batch(const IntervalVector& y, IntervalMatrix& boxes) const {
+	assert(_image_dim.is_scalar());
+	assert(boxes.nb_rows()==nb_var() && y.size()==boxes.nb_cols());
+
+	if (cf.has_tape())
+		hc4revise().proj_batch(y, boxes);
+	else
+		for (int j=0; j<boxes.nb_cols(); j++) {
+			IntervalVector box=boxes.col(j);
+			backward(y[j],box);
+			if (box.is_empty())
+				for (int k=0; k<boxes.nb_rows(); k++) boxes[k][j].set_empty();
+			else
+				boxes.set_col(j,box);
+		}
+}
+
 IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 	// --> commented to avoid treating each component separately
 	// (note that in this case, the root node of the expression is not evaluated)
@@ -206,7 +304,7 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 		M.set_col(0,eval_vector(box));
 		break;
 	case Dim::MATRIX:
-		M=((Function*) this)->_eval->eval(box).m();
+		M=basic_evaluator().eval(box).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -233,9 +331,9 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box, const BitSet& ro
 		break;
 	case Dim::MATRIX:
 		if (rows.size()==1)
-			M.set_row(0,((Function*) this)->_eval->eval(box,rows).v());
+			M.set_row(0,basic_evaluator().eval(box,rows).v());
 		else
-			M=((Function*) this)->_eval->eval(box,rows).m();
+			M=basic_evaluator().eval(box,rows).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -265,14 +363,14 @@ IntervalMatrix Function::eval_matrix(const IntervalVector& box, const BitSet& ro
 	case Dim::MATRIX:
 		if (rows.size()==1)
 			if (cols.size()==1)
-				M[0][0]=((Function*) this)->_eval->eval(box,rows,cols).i();
+				M[0][0]=basic_evaluator().eval(box,rows,cols).i();
 			else
-				M.set_row(0,((Function*) this)->_eval->eval(box,rows,cols).v());
+				M.set_row(0,basic_evaluator().eval(box,rows,cols).v());
 		else
 			if (cols.size()==1)
-				M.set_col(0,((Function*) this)->_eval->eval(box,rows,cols).v());
+				M.set_col(0,basic_evaluator().eval(box,rows,cols).v());
 			else
-		        M=((Function*) this)->_eval->eval(box,rows,cols).m();
+		        M=basic_evaluator().eval(box,rows,cols).m();
 		break;
 	default :
 		throw std::logic_error("Function::eval_matrix: invalid Dim type");
@@ -19,11 +19,19 @@
 #include "ibex_ExprSubNodes.h"
 #include "ibex_Fnc.h"
 #include "ibex_BitSet.h"
+#include "ibex_SparseIntervalMatrix.h"
 
 #include <stdexcept>
 #include <stdarg.h>
 #include <stdio.h>
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <vector>
+#endif
+
 namespace ibex {
 
 class System;
@@ -647,6 +655,22 @@ public:
 	 */
 	virtual Interval eval(const IntervalVector& box) const;
 
+	/**
+	 * \brief Calculate f on N boxes at once.
+	 *
+	 * \param boxes - the boxes in structure-of-arrays layout: a nb_var() x N
+	 *                matrix, the jth column being the jth box (so that each
+	 *                row contains the N domains of a variable).
+	 * \param y     - (output) vector of size N: y[j] is f(jth box).
+	 *
+	 * If the function has a compact tape (see #CompiledFunction::has_tape()),
+	 * each operation is performed on the N boxes in a row. Otherwise, this
+	 * is equivalent to N calls to eval(const IntervalVector&).
+	 *
+	 * \pre f must be real-valued.
+	 */
+	void eval_batch(const IntervalMatrix& boxes, IntervalVector& y) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -745,6 +769,22 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix in sparse form.
+	 *
+	 * Only the entries in the pattern of \a J are calculated.
+	 *
+	 * \pre The pattern of J contains #jacobian_pattern().
+	 */
+	void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Sparsity pattern of the Jacobian matrix.
+	 *
+	 * The ith element contains the variables the ith component depends on.
+	 */
+	std::vector<std::vector<int> > jacobian_pattern() const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -794,6 +834,16 @@ public:
 	 */
 	bool backward(const IntervalMatrix& y, IntervalVector& x) const;
 
+	/**
+	 * \brief Contract N boxes at once w.r.t. f(x)=y[j] (for the jth box).
+	 *
+	 * The boxes are in structure-of-arrays layout (see #eval_batch()).
+	 * A box that is found to be infeasible is set to the empty set.
+	 *
+	 * \pre f must be real-valued.
+	 */
+	void backward_batch(const IntervalVector& y, IntervalMatrix& boxes) const;
+
 	/**
 	 * \brief Inner projection f(x)=y onto x.
 	 */
@@ -948,6 +998,39 @@ private:
 	// TODO: actually never used if f is vector/matrix valued
 	Gradient *_grad;
 	InHC4Revise *_inhc4revise;
+
+#ifndef _WIN32 // MinGW does not support threads
+	/*
+	 * The evaluators above (and their domains) belong to the thread
+	 * that built the function. Any other thread gets its own
+	 * evaluators, created the first time it uses the function
+	 * (or taken from a thread that is over).
+	 * This allows several threads to share the same function.
+	 */
+	struct EvaluatorTable;
+
+	struct Evaluators {
+		Eval *eval;
+		HC4Revise *hc4revise;
+		Gradient *grad;
+		InHC4Revise *inhc4revise;
+		std::weak_ptr<EvaluatorTable> table; // the table of the thread using them (expired once it is over)
+	};
+
+	/*
+	 * \brief The evaluators of the calling thread (not the owner).
+	 */
+	Evaluators& thread_evaluators() const;
+
+	long _id;                                   // key of the function in the table of a thread
+	std::thread::id _owner;                     // the thread that built the function
+	mutable std::vector<Evaluators*> _others;   // evaluators created by other threads (reused)
+	mutable std::mutex _others_mtx;
+
+	// the components, the derivative and the definition domain
+	// are built on demand, possibly by concurrent threads
+	mutable std::once_flag _comp_flag, _df_flag, _def_domain_flag;
+#endif
 };
 
 } // end namespace
@@ -963,17 +1046,25 @@ namespace ibex {
 /*================================== inline implementations ========================================*/
 
 inline const Function& Function::diff() const {
+#ifndef _WIN32
+	std::call_once(_df_flag, [this]() { ((Function*&) df) = new Function(*this,DIFF); });
+	return *df;
+#else
 	return *(df ? df : (((Function*&) df) = new Function(*this,DIFF)));
+#endif
 }
 
 inline Function& Function::operator[](int i) {
+#ifndef _WIN32
+	std::call_once(_comp_flag, &Function::generate_comp, this);
+#else
 	if (!comp) generate_comp();
+#endif
 	return *comp[i];
 }
 
 inline Function& Function::operator[](int i) const {
-	if (!comp) ((Function&) *this).generate_comp();
-	return *comp[i];
+	return ((Function&) *this)[i];
 }
 
 inline int Function::nb_arg() const {
@@ -1018,23 +1109,23 @@ inline void Function::forward(const V& algo) const {
 }
 
 inline Domain& Function::eval_domain(const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box);
+	return basic_evaluator().eval(box);
 }
 
 inline Domain& Function::eval_domain(const Array<const Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return basic_evaluator().eval(d);
 }
 
 inline Domain& Function::eval_domain(const Array<Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return basic_evaluator().eval(d);
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
-	return eval_domain(box).i();
+	return cf.has_tape() ? basic_evaluator().tape_eval(box) : eval_domain(box).i();
 }
 
 inline Interval Function::eval(int i, const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box,BitSet::singleton(_image_dim.size(),i)).i();
+	return basic_evaluator().eval(box,BitSet::singleton(_image_dim.size(),i)).i();
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
@@ -1045,7 +1136,7 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
 	assert(!_image_dim.is_matrix());
 	return _image_dim.is_scalar() ?
 			IntervalVector(1,eval(box)) :
-			((Function*) this)->_eval->eval(box).v();
+			basic_evaluator().eval(box).v();
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box, const BitSet& components) const {
@@ -1053,9 +1144,9 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box, const Bit
 	return _image_dim.is_scalar() ?
 			IntervalVector(1,eval(box)) :
 			components.size()==1 ?
-					IntervalVector(1,((Function*) this)->_eval->eval(box,components).i())
+					IntervalVector(1,basic_evaluator().eval(box,components).i())
 					:
-					((Function*) this)->_eval->eval(box,components).v();
+					basic_evaluator().eval(box,components).v();
 }
 
 template<class V>
@@ -1064,7 +1155,7 @@ inline void Function::backward(const V& algo) const {
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
-	return ((Function*) this)->_hc4revise->proj(y,x);
+	return hc4revise().proj(y,x);
 }
 
 inline bool Function::backward(const Interval& y, IntervalVector& x) const {
@@ -1081,11 +1172,11 @@ inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
-	((Function*) this)->_inhc4revise->iproj(y,x);
+	inhc4revise().iproj(y,x);
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin) const {
-	((Function*) this)->_inhc4revise->iproj(y,x,xin);
+	inhc4revise().iproj(y,x,xin);
 }
 
 inline void Function::ibwd(const Interval& y, IntervalVector& x) const {
@@ -1103,7 +1194,7 @@ inline void Function::print_expr(std::ostream& os) const {
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
 	assert(g.size()==nb_var());
 	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	deriv_calculator().gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1132,7 +1223,17 @@ inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J
 }
 
 inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v) const {
-	_grad->jacobian(x, J, components, v);
+	deriv_calculator().jacobian(x, J, components, v);
+}
+
+inline void Function::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	deriv_calculator().jacobian(x, J);
+}
+
+inline std::vector<std::vector<int> > Function::jacobian_pattern() const {
+	std::vector<std::vector<int> > pattern;
+	deriv_calculator().jacobian_pattern(pattern);
+	return pattern;
 }
 
 inline void Function::hansen_matrix(const IntervalVector& x, IntervalMatrix& H) const {
@@ -1156,18 +1257,30 @@ inline void Function::hansen_matrix(const IntervalVector& full_box, const Interv
 }
 
 inline Eval& Function::basic_evaluator() const {
+#ifndef _WIN32
+	if (std::this_thread::get_id()!=_owner) return *thread_evaluators().eval;
+#endif
 	return *_eval;
 }
 
 inline Gradient& Function::deriv_calculator() const {
+#ifndef _WIN32
+	if (std::this_thread::get_id()!=_owner) return *thread_evaluators().grad;
+#endif
 	return *_grad;
 }
 
 inline HC4Revise& Function::hc4revise() const {
+#ifndef _WIN32
+	if (std::this_thread::get_id()!=_owner) return *thread_evaluators().hc4revise;
+#endif
 	return *_hc4revise;
 }
 
 inline InHC4Revise& Function::inhc4revise() const {
+#ifndef _WIN32
+	if (std::this_thread::get_id()!=_owner) return *thread_evaluators().inhc4revise;
+#endif
 	return *_inhc4revise;
 }
 
@@ -24,6 +24,7 @@
 #include "ibex_UnknownFileException.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_P_Struct.h"
+#include "ibex_Id.h"
 
 #ifndef _WIN32 // MinGW does not support mutex
 #include <mutex>
@@ -437,6 +438,7 @@ Function::Function(const Function& f, copy_mode mode) {
 }
 
 void Function::generate_comp() {
+	// note: called only once (see operator[])
 	if (expr().type()==Dim::SCALAR) {
 		comp=new Function*[1];
 		comp[0]=(Function*) this; // a function cannot be modified anyway
@@ -559,6 +561,11 @@ void Function::init(const Array<const ExprSymbol>& x, const ExprNode& y, const c
 	_grad = new Gradient(*_eval);
 	_inhc4revise = new InHC4Revise(*_eval);
 
+#ifndef _WIN32
+	_id = next_id();
+	_owner = this_thread::get_id();
+#endif
+
 	// ===== display adjacency (debug) =========
 //	cout << "adjacency of function" << *this << ":" << endl;
 //	for (int i=0; i<nb_used_inputs; i++)
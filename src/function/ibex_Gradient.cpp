@@ -235,6 +235,98 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, int v) {
 	jacobian(box,J, BitSet::all(f.image_dim()), v);
 }
 
+void Gradient::jacobian_pattern(vector<vector<int> >& pattern) {
+	int n=f.nb_var();
+	int m=f.image_dim();
+
+	pattern.assign(m, vector<int>());
+
+	if (m==1)
+		pattern[0]=f.used_vars;
+	else if (_eval.fwd_agenda!=NULL && f.all_args_scalar()) {
+		// var[z]: variable of the zth node (-1 if the node is not a symbol)
+		vector<int> var(f.nb_nodes(),-1);
+		for (int j=0; j<n; j++)
+			var[f.nodes.rank(f.arg(j))]=j;
+
+		for (int c=0; c<m; c++) {
+			const Agenda& a=*(_eval.bwd_agenda[c]);
+			for (int z=a.first(); z!=a.end(); z=a.next(z))
+				if (var[z]!=-1) pattern[c].push_back(var[z]);
+		}
+	} else {
+		// vector symbols: the ith variable is not the ith symbol
+		for (int c=0; c<m; c++)
+			pattern[c]=f[c].used_vars;
+	}
+}
+
+void Gradient::jacobian(const IntervalVector& box, SparseIntervalMatrix& J) {
+	int n=f.nb_var();
+	int m=f.image_dim();
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"jacobian\" on a matrix-valued function");
+	}
+
+	assert(J.nb_rows()==m);
+	assert(J.nb_cols()==n);
+	assert(box.size()==n);
+
+	if (m==1 || _eval.fwd_agenda==NULL || !f.all_args_scalar()) {
+		// calculate dense rows (see jacobian(const IntervalVector&, IntervalMatrix&, const BitSet&, int))
+		IntervalVector row(n);
+		for (int c=0; c<m; c++) {
+			if (m==1) gradient(box,row);
+			else f[c].gradient(box,row);
+
+			if (row.is_empty()) {
+				J.set_empty();
+				return;
+			}
+			for (int k=J.row_begin(c); k<J.row_end(c); k++)
+				J.entry(k)=row[J.col(k)];
+		}
+		return;
+	}
+
+	if (_eval.eval(box).is_empty()) {
+		// outside definition domain -> empty jacobian
+		J.set_empty();
+		return;
+	}
+
+	for (int c=0; c<m; c++) {
+
+		if (is_linear[c]) {
+			for (int k=J.row_begin(c); k<J.row_end(c); k++)
+				J.entry(k)=coeff_matrix[c][J.col(k)];
+			continue;
+		}
+
+		// the pattern of J may contain variables that do not
+		// appear in the component (and that are not reset by
+		// the forward phase)
+		for (int k=J.row_begin(c); k<J.row_end(c); k++)
+			g.args[J.col(k)].i()=0;
+
+		f.cf.forward<Gradient>(*this, *(_eval.fwd_agenda)[c]);
+
+		g[_eval.bwd_agenda[c]->first()].i() = 1.0;
+
+		f.cf.backward<Gradient>(*this, *(_eval.bwd_agenda)[c]);
+
+		for (int k=J.row_begin(c); k<J.row_end(c); k++) {
+			const Interval& gk=g.args[J.col(k)].i();
+			if (gk.is_empty()) {
+				J.set_empty();
+				return;
+			}
+			J.entry(k)=gk;
+		}
+	}
+}
+
 void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 
 	if (!f.expr().dim.is_vector()) {
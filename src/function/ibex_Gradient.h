@@ -15,6 +15,9 @@
 #include "ibex_Eval.h"
 #include "ibex_BwdAlgorithm.h"
 #include "ibex_Agenda.h"
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -71,6 +74,24 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief Calculate the Jacobian of f on the box \a box in sparse form.
+	 *
+	 * Only the entries in the pattern of \a J are calculated.
+	 *
+	 * \pre The pattern of J contains the pattern given by #jacobian_pattern().
+	 */
+	void jacobian(const IntervalVector& box, SparseIntervalMatrix& J);
+
+	/**
+	 * \brief Sparsity pattern of the Jacobian.
+	 *
+	 * Set pattern[i] to the variables the ith component of f depends on.
+	 * When f is a vector of expressions with scalar arguments, the pattern
+	 * is read from the DAG (the components are not generated).
+	 */
+	void jacobian_pattern(std::vector<std::vector<int> >& pattern);
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
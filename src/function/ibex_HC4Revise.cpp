@@ -11,10 +11,19 @@
 #include "ibex_Function.h"
 #include "ibex_HC4Revise.h"
 
+#include <algorithm>
+
 namespace ibex {
 
-HC4Revise::HC4Revise(Eval& e) : f(e.f), eval(e), d(e.d) {
+HC4Revise::HC4Revise(Eval& e) : incremental(false), f(e.f), eval(e), d(e.d), fwd(NULL), dirty(NULL), fwd_ok(false) {
+
+}
 
+HC4Revise::~HC4Revise() {
+	if (fwd) {
+		delete[] fwd;
+		delete[] dirty;
+	}
 }
 
 bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
@@ -28,10 +37,63 @@ bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
 //	return proj(y,(const Array<const Domain>&) x);
 }
 
+void HC4Revise::proj_batch(const IntervalVector& y, IntervalMatrix& boxes) {
+	int N=boxes.nb_cols();
+
+	eval.reserve_batch(N);
+	Interval* t=eval.batch;
+	bool* ok=eval.batch_ok;
+	for (int j=0; j<N; j++) ok[j]=true;
+
+	f.cf.tape_forward_batch(boxes, t, ok);
+
+	for (int j=0; j<N; j++) // root node
+		if ((t[j] &= y[j]).is_empty()) ok[j]=false;
+
+	f.cf.tape_backward_batch(N, t, ok);
+
+	f.cf.tape_read_batch(t, ok, boxes);
+}
+
 //bool HC4Revise::proj(const Domain& y, const Array<const Domain>& x) {
 //}
 
 bool HC4Revise::proj(const Domain& y, IntervalVector& x) {
+
+	if (eval.tape && incremental) {
+		int n=f.cf.tape_size();
+		if (!fwd) {
+			fwd=new Interval[n];
+			dirty=new bool[n];
+		}
+
+		fwd_ok = fwd_ok? f.cf.tape_forward(x,fwd,dirty) : f.cf.tape_forward(x,fwd);
+
+		if (!fwd_ok) {
+			x.set_empty();
+			return false;
+		}
+
+		Interval* t=eval.tape;
+		std::copy(fwd, fwd+n, t);
+		if ((t[0] &= y.i()).is_empty() || !f.cf.tape_backward(t,fwd)) {
+			x.set_empty();
+		} else {
+			f.cf.tape_read(t,x);
+		}
+		return false;
+	}
+
+	if (eval.tape) {
+		Interval* t=eval.tape;
+		if (!f.cf.tape_forward(x,t) || (t[0] &= y.i()).is_empty() || !f.cf.tape_backward(t)) {
+			x.set_empty();
+		} else {
+			f.cf.tape_read(t,x);
+		}
+		return false;
+	}
+
 	eval.eval(x);
 	//std::cout << "forward:" << std::endl; f.cf.print(d);
 
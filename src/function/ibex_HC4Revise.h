@@ -31,6 +31,18 @@ public:
 	 */
 	HC4Revise(Eval& e);
 
+	/**
+	 * \brief Delete this.
+	 */
+	~HC4Revise();
+
+	/*
+	 * HC4Revise is not copyable (the domains of the incremental
+	 * mode are owned by this object).
+	 */
+	HC4Revise(const HC4Revise&) = delete;
+	HC4Revise& operator=(const HC4Revise&) = delete;
+
 	/**
 	 * \brief Project f(x)=y onto x (forward/backward algorithm)
 	 *
@@ -42,6 +54,14 @@ public:
 	 */
 	bool proj(const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f(x)=y[j] onto the jth box, for N boxes.
+	 *
+	 * \see #Function::backward_batch(const IntervalVector&, IntervalMatrix&) const.
+	 * \pre f has a compact tape (see #CompiledFunction::has_tape()).
+	 */
+	void proj_batch(const IntervalVector& y, IntervalMatrix& boxes);
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -50,6 +70,24 @@ public:
 	 */
 	static constexpr double RATIO = 0.1;
 
+	/**
+	 * \brief Incremental mode (default: false).
+	 *
+	 * In incremental mode, the forward phase only re-evaluates the nodes
+	 * that depend on a variable whose domain has changed since the last
+	 * call and the backward phase skips the nodes whose domain has not
+	 * been contracted. The contraction is the same as in normal mode.
+	 *
+	 * This pays off with large functions and successive calls on boxes
+	 * that only differ by a few variables (e.g., in a propagation loop).
+	 * Only used if f has a compact tape (see #CompiledFunction::has_tape()).
+	 *
+	 * The HC4Revise of other threads (see #Function::hc4revise())
+	 * are created with the value of this flag in the thread that
+	 * built the function. See also #CtcFwdBwd::incremental_revise.
+	 */
+	bool incremental;
+
 protected:
 	/**
 	 * Class used internally to interrupt the
@@ -82,6 +120,15 @@ protected:
 	Eval& eval;
 	ExprDomain& d;
 
+	/*
+	 * Incremental mode: domains of the nodes computed by the
+	 * last forward phase on the tape (valid iff fwd_ok==true)
+	 * and nodes re-evaluated by the last forward phase.
+	 */
+	Interval* fwd;
+	bool* dirty;
+	bool fwd_ok;
+
 public: // because called from CompiledFunction
 	inline void idx_bwd    (int, int)          { /* nothing to do */ }
 	       void idx_cp_bwd (int, int);
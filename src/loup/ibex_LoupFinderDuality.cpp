@@ -82,7 +82,7 @@ std::pair<IntervalVector, double> LoupFinderDuality::find(const IntervalVector&
 		double new_loup=current_loup;
 
 		if (check(sys,loup_point,new_loup,false)) {
-			return std::make_pair(loup_point,new_loup);
+			return std::make_pair(IntervalVector(loup_point),new_loup);
 		}
 	}
 
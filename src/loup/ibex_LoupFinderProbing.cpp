@@ -10,8 +10,27 @@
 
 #include "ibex_LoupFinderProbing.h"
 
+#include <algorithm>
+
+using namespace std;
+
 namespace ibex {
 
+namespace {
+
+struct SampleComparator {
+
+	SampleComparator(const Vector& ub) : ub(ub) { }
+
+	bool operator()(int i, int j) const {
+		return ub[i] < ub[j];
+	}
+
+	const Vector& ub;
+};
+
+} // end anonymous namespace
+
 LoupFinderProbing::LoupFinderProbing(const System& sys, int sample_size) : sys(sys), sample_size(sample_size)/*, loup_point(sys.nb_var), loup(POS_INFINITY) */{
 
 }
@@ -26,12 +45,34 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 	bool loup_changed=false;
 	bool _is_inner = sys.is_inner(box);
 
-	for(int i=0; i<sample_size; i++) {
-		pt = box.random();
-		//	cout << " box " << box << " pt " << pt << endl;
-		if (check(sys, pt, loup, _is_inner)) {
-			loup_changed = true;
-			loup_point = pt;
+	if (sample_size>0) {
+		// the goal is evaluated on all the sample points at once
+		Matrix pts(n, sample_size);
+		for(int i=0; i<sample_size; i++) {
+			pt = box.random();
+			pts.set_col(i, pt);
+		}
+
+		Vector ub(sample_size);
+		sys.goal_ub_batch(pts, ub);
+
+		// The candidates below the loup are tried by increasing
+		// criterion: the first one that satisfies the constraints
+		// is the point that the loop "for each point: check(...)"
+		// would select, with fewer constraint checks.
+		vector<int> cand;
+		for (int i=0; i<sample_size; i++)
+			if (ub[i]<loup) cand.push_back(i);
+
+		stable_sort(cand.begin(), cand.end(), SampleComparator(ub));
+
+		for (vector<int>::const_iterator it=cand.begin(); it!=cand.end(); ++it) {
+			if (_is_inner || sys.is_inner(pts.col(*it))) {
+				loup_changed = true;
+				loup_point = pts.col(*it);
+				loup = ub[*it];
+				break;
+			}
 		}
 	}
 
@@ -57,7 +98,7 @@ std::pair<IntervalVector, double> LoupFinderProbing::find(const IntervalVector&
 	/*========================================================*/
 
 	if (loup_changed)
-		return std::make_pair(loup_point,loup);
+		return std::make_pair(IntervalVector(loup_point),loup);
 	else
 		throw NotFound();
 }
@@ -22,7 +22,8 @@ namespace ibex {
  * \brief Upper-bounding algorithm based on simple sampling and probing.
  *
  * The algorithm has two steps:
- * 1- random search: pick random points in any directions.
+ * 1- random search: pick random points in any directions
+ *    (the goal is evaluated on all the points at once).
  * 2- intensification (in the current version of the code, only in case
  *    of unconstrained optimization): perform a line probing search.
  *
@@ -65,7 +65,7 @@ std::pair<IntervalVector, double> LoupFinderXTaylor::find(const IntervalVector&
 		double new_loup=current_loup;
 
 		if (check(sys,loup_point,new_loup,false)) {
-			return std::make_pair(loup_point,new_loup);
+			return std::make_pair(IntervalVector(loup_point),new_loup);
 		}
 	}
 
@@ -42,20 +42,56 @@ std::ostream& operator<<(std::ostream& os, const LPSolver::Status x){
 	return os;
 }
 
+void LPSolver::update_rows_cache() {
+	if (rows_changed_) {
+		Matrix A_trans = rows_transposed();
+		col_start_.assign(1,0);
+		row_index_.clear();
+		col_value_.clear();
+		for (int j=0; j<A_trans.nb_rows(); j++) {
+			const Vector& col=A_trans[j];
+			for (int i=0; i<col.size(); i++)
+				if (col[i]!=0) {
+					row_index_.push_back(i);
+					col_value_.push_back(col[i]);
+				}
+			col_start_.push_back(row_index_.size());
+		}
+		rows_changed_ = false;
+		lhs_rhs_changed_ = true;
+	}
+	if (lhs_rhs_changed_) {
+		lhs_rhs_cache_ = lhs_rhs();
+		lhs_rhs_changed_ = false;
+	}
+}
+
+/*
+ * Computes y*b - (A^T*y - c)*x for all x in the bounds (b=[lhs,rhs]).
+ *
+ * Column j of A^T*y is computed on the nonzero entries only (same
+ * floating-point result as the dense product), then c_j is subtracted
+ * and the product by the bound of x_j is accumulated with interval
+ * arithmetic, without building the intermediate vectors.
+ */
+Interval LPSolver::dual_bound(const Vector& y, const Vector& c) {
+	update_rows_cache();
+	Interval res = y*lhs_rhs_cache_;
+	for (unsigned int j=0; j+1<col_start_.size(); j++) {
+		double dot = 0;
+		for (int k=col_start_[j]; k<col_start_[j+1]; k++)
+			dot += col_value_[k]*y[row_index_[k]];
+		res -= (Interval(dot)-c[j])*ivec_bounds_[j];
+	}
+	return res;
+}
+
 bool LPSolver::neumaier_shcherbina_postprocessing() {
-    Matrix A_trans = rows_transposed();
-    IntervalVector b = lhs_rhs();
-    IntervalVector rest = A_trans*uncertified_dual_;
-	rest -= cost();
-	//Interval certified_obj_raw = uncertified_dual_*b - rest*ivec_bounds_;
-	//certified_obj_ = Interval(certified_obj_raw.lb(), uncertified_obj_.ub());
-    obj_ = uncertified_dual_*b - rest*ivec_bounds_;
+	obj_ = dual_bound(uncertified_dual_, cost());
 	return true;
 }
 
 bool LPSolver::neumaier_shcherbina_infeasibility_test() {
-    ibex::Matrix A_trans = rows_transposed();
-    IntervalVector b = lhs_rhs();
     Vector lambda(1);
 	// It is possible that the solver does not find an infeasible direction
 	// even when the problem is infeasible.
@@ -64,11 +100,9 @@ bool LPSolver::neumaier_shcherbina_infeasibility_test() {
         return false;
     }
 
-
-    IntervalVector rest = A_trans * lambda ;
-    Interval d = rest * ivec_bounds_ - lambda * b;
-
-    // if 0 does not belong to d, the infeasibility is proved
+    // d = (A^T*lambda)*x - lambda*b for all x in the bounds.
+    // If 0 does not belong to d, the infeasibility is proved
+    Interval d = -dual_bound(lambda, Vector::zeros(nb_vars()));
     return !d.contains(0.0);
 }
 
@@ -129,7 +129,9 @@ public:
      * \brief Solve the LP with the current set of constraints,
      * the current objective and bounds.
      * The LP can be modified between two calls to minimize(...)
-     * The same instance of the underlying LP solver is updated.
+     * The same instance of the underlying LP solver is updated and
+     * the simplex is warm started from the last basis (e.g., when only
+     * the objective or the bounds have changed).
      *
      */
     Status minimize();
@@ -335,6 +337,12 @@ public:
     void set_cost_to_zero();
     /**
      * \brief Remove all constraints, except bound constraints.
+     *
+     * The current basis is kept and used to warm start the next call to
+     * minimize(), provided that the constraints added in the meantime
+     * have the same layout (same number of rows). This is typically the
+     * case when the same linearization is applied to successive boxes
+     * (currently with SoPlex and the native solver only).
      */
     void clear_constraints();
 
@@ -365,12 +373,26 @@ private:
 
     bool has_changed = true;
 
+    // Copy of the constraint matrix used by the certification, stored by
+    // columns (nonzero entries only): the entries of column j are
+    // col_value_[k] in row row_index_[k], for col_start_[j] <= k < col_start_[j+1].
+    // It is rebuilt only after the constraints have changed (rows_changed_),
+    // the interval [lhs,rhs] after the constraints or the bounds have changed.
+    bool rows_changed_ = true;
+    bool lhs_rhs_changed_ = true;
+    std::vector<int> col_start_;
+    std::vector<int> row_index_;
+    std::vector<double> col_value_;
+    IntervalVector lhs_rhs_cache_{1};
+
     // Bounds on variable in ibex::IntervalVector format.
     IntervalVector ivec_bounds_{1};
 
     void init(LPSolver::Mode mode, double tolerance, double timeout, int max_iter);
     bool neumaier_shcherbina_postprocessing();
     bool neumaier_shcherbina_infeasibility_test();
+    void update_rows_cache();
+    Interval dual_bound(const Vector& y, const Vector& c);
     bool uncertified_infeasible_dir(Vector& infeasible_dir) const;
 
     void invalidate();
@@ -10,10 +10,13 @@
 
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include "ibex_PackedIntervalMatrix.h"
 
 #include <math.h>
 #include <float.h>
 #include <stack>
+#include <vector>
+#include <algorithm>
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
@@ -179,6 +182,41 @@ void LU_solve(const M& LU, const int* p, const V& b, V& x) {
     }
 }
 
+// A := C*A, with the packed kernel when A is bounded
+void precond_mul(const Matrix& C, IntervalMatrix& A) {
+	PackedIntervalMatrix PA(A);
+	if (!PA.is_bounded()) { A = C*A; return; }
+	PackedIntervalMatrix CA(C.nb_rows(), A.nb_cols());
+	mul(C, PA, CA);
+	CA.get(A);
+}
+
+// b := C*b, with the packed kernel when b is bounded
+void precond_mul(const Matrix& C, IntervalVector& b) {
+	PackedIntervalMatrix Pb(b);
+	if (!Pb.is_bounded()) { b = C*b; return; }
+	PackedIntervalMatrix Cb(C.nb_rows(), 1);
+	mul(C, Pb, Cb);
+	Cb.get(b);
+}
+
+// Search an augmenting path from row r (see sparse_pivots).
+// col_row[j]: row whose pivot is in column j (-1 if none)
+// visited[j]: true if column j has already been visited
+bool augment(const SparseIntervalMatrix& A, int r, int* piv, vector<int>& col_row, vector<bool>& visited) {
+	for (int k=A.row_begin(r); k<A.row_end(r); k++) {
+		int j=A.col(k);
+		if (visited[j] || A.entry(k)==Interval::zero()) continue;
+		visited[j]=true;
+		if (col_row[j]==-1 || augment(A, col_row[j], piv, col_row, visited)) {
+			piv[r]=k;
+			col_row[j]=r;
+			return true;
+		}
+	}
+	return false;
+}
+
 } // end anonymous namespace
 
 void real_LU(const Matrix& A, Matrix& _LU, int* p) {
@@ -314,7 +352,7 @@ void precond(IntervalMatrix& A) {
 		}
 	}
 
-	A = C*A;
+	precond_mul(C, A);
 }
 
 void precond(IntervalMatrix& A, IntervalVector& b) {
@@ -334,8 +372,8 @@ void precond(IntervalMatrix& A, IntervalVector& b) {
 	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
 	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
 	//cout << "C=" << C << endl;
-	A = C*A;
-	b = C*b;
+	precond_mul(C, A);
+	precond_mul(C, b);
 }
 
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
@@ -348,20 +386,33 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 	Interval old, proj, tmp;
 	int i;
 
+	// The dot products are computed with packed bounds
+	// as long as A and x are bounded.
+	PackedIntervalMatrix PA(A);
+	PackedIntervalMatrix Px(x);
+	bool packed=PA.is_bounded();
+
 	do {
 		red = 0;
+		bool packed_x=packed && Px.is_bounded();
 		for (int r=0; r<m; r++) {
 			i=r % n; // in case m>n
 			old = x[i];
-			proj = b[r];
 
-			for (int j=0; j<n; j++)	if (j!=i) proj -= A[r][j]*x[j];
+			if (packed_x)
+				proj = b[r] - dot(PA, r, Px, i);
+			else {
+				proj = b[r];
+				for (int j=0; j<n; j++)	if (j!=i) proj -= A[r][j]*x[j];
+			}
 			tmp=A[r][i];
 
 			bwd_mul(proj,tmp,x[i]);
 
 			if (x[i].is_empty()) { x.set_empty(); return; }
 
+			Px.set(i,0,x[i]);
+
 			double gain=old.rel_distance(x[i]);
 			if (gain>red) red=gain;
 		}
@@ -380,14 +431,28 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
 	double d=DBL_MAX; // Hausdorff distances between 2 iterations
 	double dold;
 	double mu; // ratio of dist(x_k,x_{k-1)) / dist(x_{k-1},x_{k-2}).
+
+	// see gauss_seidel
+	PackedIntervalMatrix PA(A);
+	PackedIntervalMatrix Px(x);
+	bool packed=PA.is_bounded();
+
 	do {
 		dold = d;
 		xold = x;
+		bool packed_x=packed && Px.is_bounded();
 		for (int i=0; i<n; i++) {
-			proj = b[i];
-			for (int j=0; j<n; j++)	if (j!=i) proj -= A[i][j]*x[j];
+			if (packed_x)
+				proj = b[i] - dot(PA, i, Px, i);
+			else {
+				proj = b[i];
+				for (int j=0; j<n; j++)	if (j!=i) proj -= A[i][j]*x[j];
+			}
 			if (!A[i][i].contains(0)) x[i] = proj/A[i][i];
 			else x[i] = Interval::all_reals();
+			Px.set(i,0,x[i]);
+			// x[i] may become unbounded
+			packed_x = packed_x && !x[i].is_empty() && !x[i].is_unbounded();
 		}
 		d=distance(xold,x);
 		mu=d/dold;
@@ -398,6 +463,180 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
 
 }
 
+void sparse_pivots(const SparseIntervalMatrix& A, int* piv) {
+	int n=A.nb_rows();
+	if (n!=A.nb_cols()) throw NotSquareMatrixException();
+
+	vector<int> col_row(n,-1);
+
+	// greedy phase: rows with fewer entries first
+	vector<pair<int,int> > rows(n);
+	for (int r=0; r<n; r++)
+		rows[r]=make_pair(A.row_end(r)-A.row_begin(r), r);
+	sort(rows.begin(), rows.end());
+
+	for (int i=0; i<n; i++) {
+		int r=rows[i].second;
+		piv[r]=-1;
+		double best=0;
+		for (int k=A.row_begin(r); k<A.row_end(r); k++) {
+			if (col_row[A.col(k)]!=-1 || A.entry(k).contains(0)) continue;
+			double v=fabs(A.entry(k).mid());
+			if (piv[r]==-1 || v>best) {
+				piv[r]=k;
+				best=v;
+			}
+		}
+		if (piv[r]!=-1) col_row[A.col(piv[r])]=r;
+	}
+
+	// augmenting paths for the remaining rows
+	vector<bool> visited(n);
+	for (int r=0; r<n; r++) {
+		if (piv[r]!=-1) continue;
+		fill(visited.begin(), visited.end(), false);
+		if (!augment(A, r, piv, col_row, visited))
+			throw SingularMatrixException();
+	}
+}
+
+SparseIntervalMatrix sparse_precond(const SparseIntervalMatrix& A, IntervalVector& b, int block_size) {
+	int n=A.nb_rows();
+	assert(b.size()==n);
+	assert(block_size>=1);
+
+	vector<int> piv(n);
+	sparse_pivots(A, &piv[0]);
+
+	// pattern of C*A: the columns of all the rows of the block
+	vector<vector<int> > pattern(n);
+	vector<int> mark(n,-1);
+	for (int b0=0; b0<n; b0+=block_size) {
+		int b1=std::min(b0+block_size,n);
+		vector<int> cols;
+		for (int r=b0; r<b1; r++)
+			for (int k=A.row_begin(r); k<A.row_end(r); k++)
+				if (mark[A.col(k)]!=b0) {
+					mark[A.col(k)]=b0;
+					cols.push_back(A.col(k));
+				}
+		for (int r=b0; r<b1; r++)
+			pattern[r]=cols;
+	}
+
+	SparseIntervalMatrix CA(n, n, pattern);
+	IntervalVector Cb(n);
+
+	vector<int> local(n,-1); // column of a pivot -> row in the block
+	vector<int> pos(n);      // column -> entry in the current row of C*A
+
+	for (int b0=0; b0<n; b0+=block_size) {
+		int b1=std::min(b0+block_size,n);
+		int s=b1-b0;
+
+		for (int r=b0; r<b1; r++)
+			local[A.col(piv[r])]=r-b0;
+
+		Matrix M(s,s,0.0);
+		for (int r=b0; r<b1; r++)
+			for (int k=A.row_begin(r); k<A.row_end(r); k++)
+				if (local[A.col(k)]!=-1) M[r-b0][local[A.col(k)]]=A.entry(k).mid();
+
+		for (int r=b0; r<b1; r++)
+			local[A.col(piv[r])]=-1;
+
+		Matrix C(s,s);
+		try {
+			real_inverse(M,C);
+		} catch(SingularMatrixException&) {
+			C=Matrix::eye(s);
+		}
+
+		for (int i=b0; i<b1; i++) {
+			for (int k=CA.row_begin(i); k<CA.row_end(i); k++)
+				pos[CA.col(k)]=k;
+
+			Cb[i]=Interval::zero();
+			for (int r=b0; r<b1; r++) {
+				double c=C[i-b0][r-b0];
+				if (c==0) continue;
+				for (int k=A.row_begin(r); k<A.row_end(r); k++)
+					CA.entry(pos[A.col(k)]) += c*A.entry(k);
+				Cb[i] += c*b[r];
+			}
+		}
+	}
+
+	b=Cb;
+	return CA;
+}
+
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int n=A.nb_rows();
+	assert(x.size()==n);
+	assert(b.size()==n);
+
+	vector<int> piv(n);
+	sparse_pivots(A, &piv[0]);
+
+	double red;
+	Interval old, proj, tmp;
+	int i;
+
+	do {
+		red = 0;
+		for (int r=0; r<n; r++) {
+			i=A.col(piv[r]);
+			old = x[i];
+			proj = b[r];
+
+			for (int k=A.row_begin(r); k<A.row_end(r); k++)
+				if (k!=piv[r]) proj -= A.entry(k)*x[A.col(k)];
+
+			tmp=A.entry(piv[r]);
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+}
+
+bool inflating_gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
+	int n=A.nb_rows();
+	assert(n == x.size() && n == b.size());
+	assert(min_dist>0);
+
+	vector<int> piv(n);
+	sparse_pivots(A, &piv[0]);
+
+	IntervalVector xold(n);
+	Interval proj;
+	double d=DBL_MAX; // Hausdorff distances between 2 iterations
+	double dold;
+	double mu; // ratio of dist(x_k,x_{k-1)) / dist(x_{k-1},x_{k-2}).
+	do {
+		dold = d;
+		xold = x;
+		for (int r=0; r<n; r++) {
+			int i=A.col(piv[r]);
+			proj = b[r];
+			for (int k=A.row_begin(r); k<A.row_end(r); k++)
+				if (k!=piv[r]) proj -= A.entry(k)*x[A.col(k)];
+			const Interval& a=A.entry(piv[r]);
+			if (!a.contains(0)) x[i] = proj/a;
+			else x[i] = Interval::all_reals();
+		}
+		d=distance(xold,x);
+		mu=d/dold;
+	} while (mu<mu_max && d>min_dist);
+
+	return (mu<mu_max);
+}
+
 void hansen_bliek(const IntervalMatrix& A, const IntervalVector& B, IntervalVector& x) {
 	int n=A.nb_rows();
 	assert(n == A.nb_cols()); // throw NotSquareMatrixException();
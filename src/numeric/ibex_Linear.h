@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -215,6 +216,60 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
  */
 bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist=1e-12, double mu_max_divergence=1.0);
 
+/**
+ * \brief Pivots of a sparse square interval matrix.
+ *
+ * Assign to each row r of A a pivot entry piv[r] (an entry index, see
+ * #ibex::SparseIntervalMatrix) so that each column is the column of exactly
+ * one pivot. Entries that do not contain zero and with a large
+ * midpoint (in absolute value) are preferred.
+ *
+ * The rows are first handled greedily and the remaining rows are assigned
+ * by augmenting paths (maximum bipartite matching).
+ *
+ * \throw SingularMatrixException if A is structurally singular (there is no such assignment).
+ */
+void sparse_pivots(const SparseIntervalMatrix& A, int* piv);
+
+/**
+ * \brief Block midpoint preconditioning (sparse variant).
+ *
+ * The rows of A are split into consecutive blocks of (at most) \a block_size rows.
+ * The rows of a block B are multiplied by the inverse of the midpoint of the
+ * square submatrix of A formed by the rows of B and the columns of their pivots
+ * (see #sparse_pivots()). In other words, C*A is returned and b is replaced by C*b,
+ * where C is a block-diagonal real matrix.
+ *
+ * The ith row of C*A has the entries of all the rows of its block, so the
+ * number of entries is multiplied by (at most) \a block_size. If the midpoint
+ * submatrix of a block is singular, the rows of this block are unchanged.
+ *
+ * \throw SingularMatrixException if A is structurally singular.
+ */
+SparseIntervalMatrix sparse_precond(const SparseIntervalMatrix& A, IntervalVector& b, int block_size);
+
+/**
+ * \brief Gauss-Seidel algorithm (sparse variant).
+ *
+ * Same as #gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * for a sparse square matrix: the ith row is used to contract the variable of its
+ * pivot (see #sparse_pivots()). Each iteration is linear in the number of entries of A.
+ * No preconditioning is done.
+ *
+ * \throw SingularMatrixException if A is structurally singular.
+ */
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
+/**
+ * \brief Gauss-Seidel algorithm (inflating and sparse variant).
+ *
+ * Same as #inflating_gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double, double)
+ * for a sparse square matrix (see #gauss_seidel(const SparseIntervalMatrix&, const IntervalVector&, IntervalVector&, double)).
+ *
+ * \throw SingularMatrixException if A is structurally singular.
+ */
+bool inflating_gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist=1e-12, double mu_max_divergence=1.0);
+
 /**
  * \brief Hansen-Bliek algorithm.
  *
@@ -20,6 +20,7 @@ namespace ibex {
 
 double default_newton_prec=1e-07;
 double default_gauss_seidel_ratio=1e-04;
+int default_sparse_precond_block=8;
 
 
 namespace {
@@ -322,6 +323,144 @@ bool inflating_newton(const Fnc& f, const VarSet& vars, const IntervalVector& fu
 	return inflating_newton(f,&vars,full_box,box_existence,box_unicity,k_max,mu_max,delta,chi);
 }
 
+bool sparse_newton(const Function& f, IntervalVector& box, double prec, double ratio_gauss_seidel, int precond_block) {
+	int n=f.nb_var();
+	assert(f.image_dim()==n);
+	assert(box.size()==n);
+
+	SparseIntervalMatrix J(n, n, f.jacobian_pattern());
+
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(n);
+	bool reducted=false;
+	double gain;
+
+	y1 = box.mid();
+
+	do {
+		f.jacobian(box,J);
+
+		if (J.is_empty()) break;
+
+		mid = box.mid();
+
+		Fmid = f.eval_vector(mid);
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		try {
+			if (precond_block>0) {
+				// note: Fmid is preconditioned as well
+				SparseIntervalMatrix CJ=sparse_precond(J, Fmid, precond_block);
+				gauss_seidel(CJ, Fmid, y, ratio_gauss_seidel);
+			} else
+				gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+
+			if (y.is_empty()) {
+				reducted=true;
+				box.set_empty();
+				break;
+			}
+		} catch (LinearException& ) {
+			assert(!reducted);
+			break;
+		}
+
+		IntervalVector box2=mid-y;
+
+		if ((box2 &= box).is_empty()) {
+			reducted=true;
+			box.set_empty();
+			break;
+		}
+		gain = box.maxdelta(box2);
+
+		if (gain >= prec) reducted = true;
+
+		box=box2;
+	}
+	while (gain >= prec);
+
+	return reducted;
+}
+
+bool sparse_inflating_newton(const Function& f, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi, int precond_block) {
+	int n=f.nb_var();
+	assert(f.image_dim()==n);
+	assert(full_box.size()==n);
+
+	if (full_box.is_empty()) {
+		box_existence.set_empty();
+		box_unicity.set_empty();
+		return false;
+	}
+
+	int k=0;
+	bool success=false;
+
+	IntervalVector mid(n);       // Midpoint of the current box
+	IntervalVector Fmid(n);      // Evaluation of f at the midpoint
+	SparseIntervalMatrix J(n, n, f.jacobian_pattern()); // Jacobian of f
+
+	IntervalVector y(n);
+	IntervalVector box = full_box;
+
+	// see inflating_newton
+	box_existence = full_box;
+	box_unicity = full_box;
+
+	while (k<k_max) {
+
+		f.jacobian(box_existence, J);
+
+		if (J.is_empty()) break;
+
+		mid = box.mid();
+
+		Fmid=f.eval_vector(mid);
+
+		y = mid-box;
+
+		try {
+			if (precond_block>0) {
+				SparseIntervalMatrix CJ=sparse_precond(J, Fmid, precond_block);
+				if (!inflating_gauss_seidel(CJ, Fmid, y, 1e-12, mu_max))
+					break;
+			} else if (!inflating_gauss_seidel(J, Fmid, y, 1e-12, mu_max))
+				break;
+		} catch(LinearException&) {
+			break;
+		}
+
+		IntervalVector box2=mid-y;
+
+		if (box2.is_subset(box)) {
+
+			assert(!box2.is_empty());
+
+			if (!success) box_unicity = box;
+
+			success=true;
+		}
+
+		box = success? box2 : box2.inflate(delta,chi);
+
+		k++;
+
+		box_existence = box;
+	}
+
+	if (!success) {
+		box_existence.set_empty();
+		box_unicity.set_empty();
+	}
+	return success;
+}
+
 VarSet get_newton_vars(const Fnc& f, const Vector& pt, const BitSet& forced_params) {
 	VarSet v(forced_params.size(), forced_params);
 	return get_newton_vars(f, pt, v);
@@ -12,6 +12,7 @@
 #define __IBEX_NEWTON_H__
 
 #include "ibex_Fnc.h"
+#include "ibex_Function.h"
 #include "ibex_VarSet.h"
 
 namespace ibex {
@@ -26,6 +27,11 @@ extern double default_newton_prec;
  */
 extern double default_gauss_seidel_ratio;
 
+/**
+ * \brief Default size of the blocks of the sparse preconditioner
+ */
+extern int default_sparse_precond_block;
+
 /** \ingroup numeric
  *
  * \brief Multivariate Newton operator (contracting).
@@ -103,6 +109,47 @@ bool inflating_newton(const Fnc& f, const VarSet& vars, const IntervalVector& bo
 		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12);
 
 
+/**
+ * \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (contracting), sparse variant.
+ *
+ * Same as #ibex::newton(const Fnc&, IntervalVector&, double, double) but the
+ * Jacobian matrix is a #ibex::SparseIntervalMatrix (with the pattern of
+ * #ibex::Function::jacobian_pattern()) and the linear routine is the
+ * \link ibex::gauss_seidel(const SparseIntervalMatrix&, const IntervalVector&, IntervalVector&, double) sparse Gauss-Seidel \endlink.
+ *
+ * The Jacobian is preconditioned by blocks (see #ibex::sparse_precond()): the
+ * equations are split into consecutive blocks of \a precond_block equations and
+ * each block is multiplied by the inverse of the midpoint of its diagonal
+ * submatrix. A full inverse-midpoint preconditioner would make the matrix dense.
+ * Coupled variables are therefore handled well if their equations are in the
+ * same block. Each iteration is linear in the number of nonzero entries of the
+ * Jacobian (times \a precond_block). With \a precond_block=0, no preconditioning is
+ * done (this requires that, for each equation, one variable is predominant).
+ *
+ * The default value of \a precond_block is #default_sparse_precond_block (8).
+ *
+ * \pre f is square (f.image_dim()==f.nb_var()).
+ */
+bool sparse_newton(const Function& f, IntervalVector& box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio,
+		int precond_block=default_sparse_precond_block);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (inflating), sparse variant.
+ *
+ * Same as #ibex::inflating_newton(const Fnc&, const IntervalVector&, IntervalVector&, IntervalVector&, int, double, double, double)
+ * with a sparse Jacobian matrix (see #ibex::sparse_newton()).
+ *
+ * \pre f is square (f.image_dim()==f.nb_var()).
+ */
+bool sparse_inflating_newton(const Function& f, const IntervalVector& box, IntervalVector& box_existence, IntervalVector& box_unicity,
+		int k_max_iteration=15, double mu_max_divergence=1.0,
+		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12,
+		int precond_block=default_sparse_precond_block);
+
 /**
  * Determine which variables should be considered as parameters
  * when solving an under-constrained system f(x)=0 around a point "pt"
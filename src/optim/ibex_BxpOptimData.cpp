@@ -10,6 +10,8 @@
 #include "ibex_BxpOptimData.h"
 #include "ibex_Id.h"
 
+#include <mutex>
+
 namespace ibex {
 
 Map<long,long,false>& BxpOptimData::ids() {
@@ -30,6 +32,10 @@ BxpOptimData::~BxpOptimData() {
 }
 
 long BxpOptimData::get_id(const ExtendedSystem& sys) {
+	// the map is shared by the threads of a parallel search
+	static std::mutex ids_mutex;
+	std::lock_guard<std::mutex> lock(ids_mutex);
+
 	try {
 		return ids()[sys.id];
 	} catch(Map<long,long,false>::NotFound&) {
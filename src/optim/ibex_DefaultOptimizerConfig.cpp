@@ -42,7 +42,7 @@ enum { 	NORMALIZED_SYSTEM_TAG,
 
 }
 
-DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys) : sys(sys), kkt(false) {
+DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys) : sys(sys), kkt(false), parent(NULL) {
 	set_eps_h(ExtendedSystem::default_eps_h);
 	set_rigor(default_rigor);
 	set_inHC4(default_inHC4);
@@ -54,7 +54,7 @@ DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys) : sys(sys), kk
 // note:deprecated.
 DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys, double rel_eps_f, double abs_eps_f,
 							double eps_h, bool rigor, bool inHC4, bool kkt,
-							double random_seed, double eps_x) : sys(sys) {
+							double random_seed, double eps_x) : sys(sys), parent(NULL) {
 
 	set_rel_eps_f(rel_eps_f);
 	set_abs_eps_f(abs_eps_f);
@@ -126,7 +126,9 @@ void DefaultOptimizerConfig::set_random_seed(double _random_seed) {
 // and we don't know which argument is evaluated first
 
 NormalizedSystem& DefaultOptimizerConfig::get_norm_sys() {
-	if (found(NORMALIZED_SYSTEM_TAG)) {
+	if (parent) {
+		return parent->get_norm_sys();
+	} else if (found(NORMALIZED_SYSTEM_TAG)) {
 		return get<NormalizedSystem>(NORMALIZED_SYSTEM_TAG);
 	} else {
 		return rec(new NormalizedSystem(sys,eps_h), NORMALIZED_SYSTEM_TAG);
@@ -134,7 +136,9 @@ NormalizedSystem& DefaultOptimizerConfig::get_norm_sys() {
 }
 
 ExtendedSystem& DefaultOptimizerConfig::get_ext_sys() {
-	if (found(EXTENDED_SYSTEM_TAG)) {
+	if (parent) {
+		return parent->get_ext_sys();
+	} else if (found(EXTENDED_SYSTEM_TAG)) {
 		return get<ExtendedSystem>(EXTENDED_SYSTEM_TAG);
 	} else {
 		return rec(new ExtendedSystem(sys,eps_h), EXTENDED_SYSTEM_TAG);
@@ -213,4 +217,32 @@ int DefaultOptimizerConfig::goal_var() {
 	return get_ext_sys().goal_var();
 }
 
+OptimizerConfig* DefaultOptimizerConfig::worker_config() {
+	DefaultOptimizerConfig* c=new DefaultOptimizerConfig(sys);
+
+	// note: the setters are not called (the
+	// checks have already been done for this one)
+	c->rel_eps_f      = rel_eps_f;
+	c->abs_eps_f      = abs_eps_f;
+	c->eps_x          = eps_x;
+	c->trace          = trace;
+	c->timeout        = timeout;
+	c->extended_COV   = extended_COV;
+	c->anticipated_UB = anticipated_UB;
+	c->eps_h          = eps_h;
+	c->rigor          = rigor;
+	c->inHC4          = inHC4;
+	c->kkt            = kkt;
+	c->random_seed    = random_seed;
+
+	// the systems are shared (functions can
+	// be evaluated by concurrent threads)
+	c->parent         = parent ? parent : this;
+
+	// the constructor has reset the random seed
+	RNG::srand(random_seed);
+
+	return c;
+}
+
 } /* namespace ibex */
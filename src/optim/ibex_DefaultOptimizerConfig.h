@@ -142,6 +142,8 @@ protected:
 	virtual CellBufferOptim& get_cell_buffer();
 
 	virtual int goal_var();
+
+	virtual OptimizerConfig* worker_config();
 	// ============================================================================
 
 	/**
@@ -163,6 +165,13 @@ protected:
 	bool inHC4;
 	bool kkt;
 	double random_seed;
+
+	/*
+	 * The configuration this one is a copy of (if it is
+	 * the configuration of a worker), NULL otherwise.
+	 * The normalized and extended systems are shared.
+	 */
+	DefaultOptimizerConfig* parent;
 };
 
 
@@ -13,11 +13,21 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_BxpOptimData.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_Random.h"
 
 #include <float.h>
 #include <stdlib.h>
 #include <iomanip>
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <exception>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -47,22 +57,26 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 						n(n), goal_var(goal_var),
 										ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
 										eps_x(eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true),
+										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true), random_seed(0), profiler(NULL),
 										status(SUCCESS),
 										uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 										loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
-										time(0), nb_cells(0), cov(NULL) {
+										time(0), nb_cells(0), cov(NULL), prof_ctc(NULL), prof_bsc(NULL), prof_loup(NULL) {
 
 	if (trace) cout.precision(12);
 }
 
 
 Optimizer::Optimizer(OptimizerConfig& config) :
+		Optimizer(config, config.get_nb_threads()>1 ? config.worker_config() : NULL) {
+}
+
+Optimizer::Optimizer(OptimizerConfig& config, OptimizerConfig* op_config) :
 		n           (config.nb_var()),
 		goal_var    (config.goal_var()),
-		ctc         (config.get_ctc()),
-		bsc         (config.get_bsc()),
-		loup_finder (config.get_loup_finder()),
+		ctc         ((op_config? *op_config : config).get_ctc()),
+		bsc         ((op_config? *op_config : config).get_bsc()),
+		loup_finder ((op_config? *op_config : config).get_loup_finder()),
 		buffer      (config.get_cell_buffer()),
 		eps_x       (config.get_eps_x()),
 		rel_eps_f   (config.get_rel_eps_f()),
@@ -71,15 +85,46 @@ Optimizer::Optimizer(OptimizerConfig& config) :
 		timeout     (config.get_timeout()),
 		extended_COV(config.with_extended_cov()),
 		anticipated_upper_bounding(config.with_anticipated_upper_bounding()),
+		random_seed (config.get_random_seed()),
+		profiler(NULL),
 		status(SUCCESS),
 		uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 		loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
-		time(0), nb_cells(0), cov(NULL) {
-
+		time(0), nb_cells(0), cov(NULL), prof_ctc(NULL), prof_bsc(NULL), prof_loup(NULL) {
+
+	if (config.get_nb_threads()>1) {
+		// the first worker shares its operators with this optimizer
+		OptimizerConfig* c=op_config;
+		for (int i=0; i<config.get_nb_threads(); i++) {
+			if (i>0) c=config.worker_config();
+			if (!c) {
+				ibex_warning("[Optimizer] parallel mode not supported by this configuration");
+				break;
+			}
+			helper_configs.push_back(c);
+			helpers.push_back(new Optimizer(*c));
+			add_worker(*helpers.back());
+		}
+	}
 }
 
 Optimizer::~Optimizer() {
 	if (cov) delete cov;
+
+	for (size_t i=0; i<helpers.size(); i++) {
+		delete helpers[i];
+		delete helper_configs[i];
+	}
+}
+
+void Optimizer::add_worker(Optimizer& worker) {
+	if (worker.n!=n || worker.goal_var!=goal_var)
+		ibex_error("[Optimizer] the worker does not optimize the same problem");
+#ifndef _WIN32
+	workers.push_back(&worker);
+#else
+	ibex_warning("[Optimizer] parallel mode not supported on this platform (worker ignored)");
+#endif
 }
 
 // compute the value ymax (decreasing the loup with the precision)
@@ -102,9 +147,17 @@ double Optimizer::compute_ymax() {
 
 bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 
+	double t=0;
+
+	if (profiler) {
+		if (!prof_loup) prof_loup=&profiler->entry("loup finder "+Profiler::type_name(typeid(loup_finder)));
+		t=Profiler::now();
+	}
+
 	try {
 
 		pair<IntervalVector,double> p=loup_finder.find(box,loup_point,loup,prop);
+		if (profiler) profiler->add(*prof_loup, Profiler::now()-t);
 		loup_point = p.first;
 		loup = p.second;
 
@@ -120,10 +173,42 @@ bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 		return true;
 
 	} catch(LoupFinder::NotFound&) {
+		if (profiler) profiler->add(*prof_loup, Profiler::now()-t);
 		return false;
 	}
 }
 
+void Optimizer::contract(Cell& c, ContractContext& context) {
+	if (!profiler) {
+		ctc.contract(c.box,context);
+		return;
+	}
+
+	if (!prof_ctc) prof_ctc=&profiler->entry("contractor "+Profiler::type_name(typeid(ctc)));
+
+	IntervalVector before(c.box);
+	double t=Profiler::now();
+	ctc.contract(c.box,context);
+	profiler->add(*prof_ctc, Profiler::now()-t, before, c.box);
+}
+
+pair<Cell*,Cell*> Optimizer::bisect(Cell& c) {
+	if (!profiler)
+		return bsc.bisect(c);
+
+	if (!prof_bsc) prof_bsc=&profiler->entry("bisector "+Profiler::type_name(typeid(bsc)));
+
+	double t=Profiler::now();
+	try {
+		pair<Cell*,Cell*> p=bsc.bisect(c);
+		profiler->add(*prof_bsc, Profiler::now()-t);
+		return p;
+	} catch(NoBisectableVariableException&) {
+		profiler->add(*prof_bsc, Profiler::now()-t);
+		throw;
+	}
+}
+
 //bool Optimizer::update_entailed_ctr(const IntervalVector& box) {
 //	for (int j=0; j<m; j++) {
 //		if (entailed->normalized(j)) {
@@ -138,11 +223,11 @@ bool Optimizer::update_loup(const IntervalVector& box, BoxProperties& prop) {
 //	return true;
 //}
 
-void Optimizer::update_uplo() {
+void Optimizer::update_uplo(double lb) {
 	double new_uplo=POS_INFINITY;
 
-	if (! buffer.empty()) {
-		new_uplo= buffer.minimum();
+	if (! buffer.empty() || lb < POS_INFINITY) {
+		new_uplo= buffer.empty() ? lb : std::min(buffer.minimum(), lb);
 		if (new_uplo > loup && uplo_of_epsboxes > loup) {
 			cout << " loup = " << loup << " new_uplo=" << new_uplo <<  " uplo_of_epsboxes=" << uplo_of_epsboxes << endl;
 			ibex_error("optimizer: new_uplo>loup (please report bug)");
@@ -234,7 +319,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 		context.impact.add(goal_var);
 	}
 
-	ctc.contract(c.box, context);
+	contract(c, context);
 	//cout << c.prop << endl;
 	if (c.box.is_empty()) return;
 
@@ -320,6 +405,8 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 
 	nb_cells=0;
 
+	prof_ctc = prof_bsc = prof_loup = NULL;
+
 	buffer.flush();
 
 	Cell* root=new Cell(IntervalVector(n+1));
@@ -369,6 +456,8 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 
 	nb_cells=0;
 
+	prof_ctc = prof_bsc = prof_loup = NULL;
+
 	buffer.flush();
 
 	for (size_t i=loup_point.is_empty()? 0 : 1; i<data.size(); i++) {
@@ -418,7 +507,17 @@ Optimizer::Status Optimizer::optimize() {
 
 	update_uplo();
 
+	// the sub-contractors are profiled during the search only
+	CtcProfilerScope profiling(profiler);
+	profiling.add(ctc);
+	for (vector<Optimizer*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		if (&(*it)->ctc!=&ctc) // (may be shared, see constructor)
+			profiling.add((*it)->ctc);
+
 	try {
+		if (!workers.empty())
+			optimize_parallel();
+		else
 	     while (!buffer.empty()) {
 
 			loup_changed=false;
@@ -428,7 +527,7 @@ Optimizer::Status Optimizer::optimize() {
 
 			try {
 
-				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+				pair<Cell*,Cell*> new_cells=bisect(*c);
 				buffer.pop();
 				delete c; // deletes the cell.
 
@@ -479,7 +578,8 @@ Optimizer::Status Optimizer::optimize() {
 		}
 
 	 	timer.stop();
-	 	time = timer.get_time();
+	 	if (workers.empty())
+	 		time = timer.get_time(); // (in parallel mode, set by optimize_parallel)
 
 		// No solution found and optimization stopped with empty buffer
 		// before the required precision is reached => means infeasible problem
@@ -538,6 +638,251 @@ Optimizer::Status Optimizer::optimize() {
 	return status;
 }
 
+#ifndef _WIN32
+
+struct Optimizer::ParallelSearch {
+
+	ParallelSearch(Optimizer& master, int nb_threads) : master(master), lb(nb_threads, POS_INFINITY),
+			busy(0), over(false), time_out(false), start(chrono::steady_clock::now()) { }
+
+	/*
+	 * Lower bound of the cells currently handled by the threads.
+	 * The cells that cannot contain a better point than the
+	 * loup anymore are ignored (they will be discarded).
+	 */
+	double handled_lb() const {
+		double ymax=master.loup==POS_INFINITY ? POS_INFINITY : master.compute_ymax();
+		double m=POS_INFINITY;
+		for (vector<double>::const_iterator it=lb.begin(); it!=lb.end(); ++it)
+			if (*it<m && *it<=ymax) m=*it;
+		return m;
+	}
+
+	/*
+	 * Stop all the threads.
+	 */
+	void stop() {
+		over=true;
+		cv.notify_all();
+	}
+
+	double elapsed() const {
+		return chrono::duration<double>(chrono::steady_clock::now()-start).count();
+	}
+
+	// holds the buffer, the loup and the uplo
+	Optimizer& master;
+
+	// protects the master and the fields below
+	mutex mtx;
+
+	// notified when new cells are pushed or the search is over
+	condition_variable cv;
+
+	// lower bound of the cell handled by each thread (+oo if none)
+	vector<double> lb;
+
+	// number of threads handling a cell
+	int busy;
+
+	bool over;
+
+	bool time_out;
+
+	chrono::steady_clock::time_point start;
+
+	// first exception raised by a thread (if any)
+	exception_ptr error;
+};
+
+void Optimizer::optimize_parallel() {
+
+	ParallelSearch search(*this, workers.size());
+
+	for (vector<Optimizer*>::iterator it=workers.begin(); it!=workers.end(); ++it) {
+		Optimizer& w=**it;
+		w.trace=trace;
+		w.timeout=timeout;
+		w.anticipated_upper_bounding=anticipated_upper_bounding;
+		w.random_seed=random_seed;
+		w.profiler=profiler;
+		w.prof_ctc=w.prof_bsc=w.prof_loup=NULL;
+		w.loup=loup;
+		w.loup_point=loup_point;
+	}
+
+	vector<thread> threads;
+	for (size_t k=1; k<workers.size(); k++)
+		threads.push_back(thread(&Optimizer::run_worker, workers[k], k, ref(search)));
+
+	workers[0]->run_worker(0, search);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	time = search.elapsed();
+
+	if (search.error)
+		rethrow_exception(search.error);
+
+	if (search.time_out)
+		throw TimeOutException();
+}
+
+void Optimizer::run_worker(int k, ParallelSearch& search) {
+
+	Optimizer& m=search.master; // note: only accessed when the mutex is locked
+
+	// the random number generator is thread local
+	if (k>0) RNG::srand((int) (random_seed+k));
+
+	unique_lock<mutex> lock(search.mtx);
+
+	while (!search.over) {
+
+		// only the first thread checks the time
+		if (k==0 && timeout>0 && search.elapsed()>=timeout) {
+			search.time_out=true;
+			search.stop();
+			break;
+		}
+
+		if (m.buffer.empty()) {
+			if (search.busy==0) { // search is over
+				search.stop();
+				break;
+			}
+			// (wake up regularly for checking time)
+			search.cv.wait_for(lock, chrono::milliseconds(10));
+			continue;
+		}
+
+		// for double heap, top has to be called before pop
+		Cell *c = m.buffer.top();
+		m.buffer.pop();
+		if (trace >= 2) cout << " current box " << c->box << endl;
+
+		search.lb[k]=c->box[goal_var].lb();
+		search.busy++;
+
+		// get the current bounds
+		if (loup!=m.loup) {
+			loup=m.loup;
+			loup_point=m.loup_point;
+		}
+		double loup_before=loup;
+		uplo=m.uplo;
+		uplo_of_epsboxes=m.uplo_of_epsboxes;
+		loup_changed=false;
+
+		lock.unlock();
+
+		pair<Cell*,Cell*> new_cells(NULL,NULL);
+		double eps_box_lb=POS_INFINITY;
+
+		try {
+			// the cell may have been created by another thread
+			bsc.add_property(c->box, c->prop);
+			ctc.add_property(c->box, c->prop);
+			loup_finder.add_property(c->box, c->prop);
+
+			try {
+				new_cells=bisect(*c);
+				delete c;
+				c=NULL;
+				contract_and_bound(*new_cells.first);
+				contract_and_bound(*new_cells.second);
+			}
+			catch (NoBisectableVariableException& ) {
+				eps_box_lb=(c->box)[goal_var].lb();
+				delete c;
+				c=NULL;
+			}
+		} catch(...) {
+			// the cells being processed are lost
+			if (c) delete c;
+			if (new_cells.first) {
+				delete new_cells.first;
+				delete new_cells.second;
+			}
+			lock.lock();
+			if (!search.error) search.error=current_exception();
+			search.lb[k]=POS_INFINITY;
+			search.busy--;
+			search.stop();
+			break;
+		}
+
+		lock.lock();
+
+		search.lb[k]=POS_INFINITY;
+		search.busy--;
+
+		if (new_cells.first) {
+
+			m.nb_cells+=2;
+
+			if (loup_changed && loup<m.loup) {
+				m.loup=loup;
+				m.loup_point=loup_point;
+			}
+
+			// lower bound of tiny boxes found by contract_and_bound
+			if (uplo_of_epsboxes < m.uplo_of_epsboxes)
+				m.uplo_of_epsboxes = uplo_of_epsboxes;
+
+			for (int i=0; i<2; i++) {
+				Cell* ci= i==0 ? new_cells.first : new_cells.second;
+				if (ci->box.is_empty())
+					delete ci;
+				else
+					m.buffer.push(ci);
+			}
+
+			if (m.uplo_of_epsboxes == NEG_INFINITY) {
+				search.stop();
+				break;
+			}
+
+			// the subcells have been contracted w.r.t. an old loup
+			// or other threads have to take into account the new one.
+			if (m.loup < loup_before) {
+				double ymax=m.compute_ymax();
+
+				m.buffer.contract(ymax);
+
+				if (ymax <= NEG_INFINITY) {
+					if (trace) cout << " infinite value for the minimum " << endl;
+					search.stop();
+					break;
+				}
+			}
+		} else if (m.loup==POS_INFINITY || eps_box_lb<=m.compute_ymax()) {
+			// (otherwise, the box would have been removed from the buffer
+			// in sequential mode)
+			m.update_uplo_of_epsboxes(eps_box_lb);
+		}
+
+		m.update_uplo(search.handled_lb());
+
+		if (!anticipated_upper_bounding) // useless to check precision on objective if 'true'
+			if (m.get_obj_rel_prec()<rel_eps_f || m.get_obj_abs_prec()<abs_eps_f) {
+				search.stop();
+				break;
+			}
+
+		search.cv.notify_all();
+	}
+}
+
+#else
+
+void Optimizer::optimize_parallel() {
+	not_implemented("parallel mode on this platform");
+}
+
+#endif
+
 namespace {
 const char* green() {
 #ifndef _WIN32
@@ -13,6 +13,9 @@
 
 #include "ibex_OptimizerConfig.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_Profiler.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -140,6 +143,27 @@ public:
 	 */
 	Status optimize(const char* cov_file, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Add a worker (parallel mode).
+	 *
+	 * The worker is another optimizer for the same problem, with its own
+	 * contractor, bisector and loup finder (and built with the same
+	 * precision settings). Once at least one worker is added, optimize(...)
+	 * runs one thread per worker. This optimizer only holds the data shared
+	 * by the threads: its cell buffer, the loup and the uplo. Each thread
+	 * repeatedly pulls the best cell from the buffer, bisects and contracts
+	 * it with its own operators and pushes back the subcells. A new loup
+	 * found by a thread is immediately visible to the others.
+	 *
+	 * The trace and timeout settings are those of this optimizer. In parallel
+	 * mode, the timeout is measured in wall-clock time.
+	 *
+	 * Workers are automatically created by Optimizer(OptimizerConfig&) if
+	 * the configuration asks for several threads (see
+	 * #OptimizerConfig::set_nb_threads(int)).
+	 */
+	void add_worker(Optimizer& worker);
+
 	/* =========================== Output ============================= */
 
 	/**
@@ -193,6 +217,7 @@ public:
 	 * \brief Get the time spent.
 	 *
 	 * \return the total CPU time of last call to optimize(...)
+	 *         (wall-clock time in parallel mode)
 	 */
 	double get_time() const;
 
@@ -312,6 +337,29 @@ public:
 	 */
 	bool anticipated_upper_bounding; // TODO: should be set in OptimizerConfig
 
+	/**
+	 * \brief Seed of the random number generators of the workers.
+	 *
+	 * In parallel mode (see #add_worker(Optimizer&)), the k-th additional
+	 * thread (k>=1) seeds its generator with random_seed+k. The generator
+	 * of the calling thread is left untouched. By default, the seed of
+	 * the configuration (0 with the first constructor).
+	 */
+	double random_seed;
+
+	/**
+	 * \brief Profiler (opt-in instrumentation).
+	 *
+	 * If not NULL, the calls to the contractor (and to all its
+	 * sub-contractors, see #ibex::CtcProfiler::instrument), to the
+	 * bisector and to the loup finder are recorded in this profiler
+	 * during optimize(...). In parallel mode, the workers feed the
+	 * same profiler.
+	 *
+	 * The profiler is not owned by the optimizer. By default, it is NULL.
+	 */
+	Profiler* profiler;
+
 protected:
 	/*
 	 * \brief Initialize the optimizer from a single box.
@@ -366,14 +414,27 @@ protected:
 
 	/**
 	 * \brief Update the uplo
+	 *
+	 * \param lb - (parallel mode) lower bound of the cells currently
+	 *             handled by the threads (and not in the buffer).
 	 */
-	void update_uplo();
+	void update_uplo(double lb=POS_INFINITY);
 
 	/**
 	 * \brief Main procedure for updating the loup.
 	 */
 	bool update_loup(const IntervalVector& box, BoxProperties& prop);
 
+	/**
+	 * \brief Contract a cell (recorded by the profiler, if any).
+	 */
+	void contract(Cell& c, ContractContext& context);
+
+	/**
+	 * \brief Bisect a cell (recorded by the profiler, if any).
+	 */
+	std::pair<Cell*,Cell*> bisect(Cell& c);
+
 	/**
 	 * \brief Computes and returns  the value ymax (the loup decreased with the precision)
 	 * the heap and the current box are actually contracted with y <= ymax
@@ -404,6 +465,27 @@ protected:
 	 */
 	void read_ext_box(const IntervalVector& ext_box, IntervalVector& box);
 
+	/*=======================================================================================================*/
+	/*                                             Parallel mode                                             */
+	/*=======================================================================================================*/
+
+	/*
+	 * Data shared by the threads (see ibex_Optimizer.cpp).
+	 */
+	struct ParallelSearch;
+
+	/**
+	 * \brief Run the optimizer with the workers (once started).
+	 *
+	 * \throw TimeOutException if time is out.
+	 */
+	void optimize_parallel();
+
+	/**
+	 * \brief Loop of the kth thread (called on a worker).
+	 */
+	void run_worker(int k, ParallelSearch& search);
+
 private:
 
 	Optimizer(const Optimizer&); // forbidden
@@ -451,6 +533,27 @@ private:
 
 	/** Result. */
 	CovOptimData* cov;
+
+	/** Workers (parallel mode). */
+	std::vector<Optimizer*> workers;
+
+	/**
+	 * \brief Build the optimizer with the operators of \a op_config.
+	 *
+	 * In parallel mode, \a op_config is the configuration of the first
+	 * worker: this optimizer only uses the operators before the threads
+	 * start (root cell), so they can be shared with this worker.
+	 */
+	Optimizer(OptimizerConfig& config, OptimizerConfig* op_config);
+
+	/** Workers created (and owned) by this optimizer, with their configuration. */
+	std::vector<Optimizer*> helpers;
+	std::vector<OptimizerConfig*> helper_configs;
+
+	/** Entries of the profiler (NULL if not created yet). */
+	Profiler::Entry* prof_ctc;
+	Profiler::Entry* prof_bsc;
+	Profiler::Entry* prof_loup;
 };
 
 inline Optimizer::Status Optimizer::get_status() const { return status; }
@@ -114,6 +114,17 @@ public:
 	 */
 	void set_anticipated_upper_bounding(bool antipated_upper_bounding);
 
+	/**
+	 * \brief Set the number of threads.
+	 *
+	 * With more than one thread, the optimizer runs in parallel
+	 * mode (see #Optimizer::add_worker(Optimizer&)). The result
+	 * is then not deterministic.
+	 *
+	 * Default value: 1.
+	 */
+	void set_nb_threads(int nb_threads);
+
 	/** see #set_rel_eps_f(). */
 	double get_rel_eps_f() const;
 
@@ -135,6 +146,9 @@ public:
 	/** see #set_anticipated_upper_bounding(). */
 	bool with_anticipated_upper_bounding() const;
 
+	/** see #set_nb_threads(). */
+	int get_nb_threads() const;
+
 	/** Default goal relative precision: 1e-3. */
 	static constexpr double default_rel_eps_f = 1e-03;
 
@@ -156,6 +170,9 @@ public:
 	/** Default anticipated upper bounding : true (enabled). */
 	static constexpr bool default_anticipated_UB = true;
 
+	/** Default number of threads: 1 (sequential). */
+	static constexpr int default_nb_threads = 1;
+
 protected:
 
 	friend class Optimizer;
@@ -177,6 +194,29 @@ protected:
 	virtual int goal_var()=0;
 	// ============================================================================
 
+	/**
+	 * \brief Configuration of a worker (parallel mode).
+	 *
+	 * Return a new configuration with the same settings, for a
+	 * worker optimizer that will run in a separate thread (see
+	 * #Optimizer::add_worker(Optimizer&)). The operators (contractor,
+	 * bisector, etc.) of the worker must not be shared with this one.
+	 * The caller takes ownership of the returned object.
+	 *
+	 * By default, return NULL (parallel mode not supported).
+	 */
+	virtual OptimizerConfig* worker_config();
+
+	/**
+	 * \brief Seed of the random numbers.
+	 *
+	 * In parallel mode, the k-th worker thread (k>=1) seeds its
+	 * generator with this value+k (see #Optimizer::random_seed).
+	 *
+	 * By default, return 0.
+	 */
+	virtual double get_random_seed();
+
 	double rel_eps_f;
 	double abs_eps_f;
 	double eps_x;
@@ -184,6 +224,7 @@ protected:
 	double timeout;
 	bool extended_COV;
 	bool anticipated_UB;
+	int nb_threads;
 };
 
 inline OptimizerConfig::OptimizerConfig() {
@@ -194,6 +235,7 @@ inline OptimizerConfig::OptimizerConfig() {
 	timeout        = OptimizerConfig::default_timeout;
 	extended_COV   = OptimizerConfig::default_extended_cov;
 	anticipated_UB = OptimizerConfig::default_anticipated_UB;
+	nb_threads     = OptimizerConfig::default_nb_threads;
 }
 
 inline void OptimizerConfig::set_rel_eps_f(double _rel_eps_f)     { rel_eps_f = _rel_eps_f; }
@@ -210,6 +252,8 @@ inline void OptimizerConfig::set_extended_cov(bool _extended_COV) { extended_COV
 
 inline void OptimizerConfig::set_anticipated_upper_bounding(bool _antipated_UB) { anticipated_UB = _antipated_UB; }
 
+inline void OptimizerConfig::set_nb_threads(int _nb_threads)      { nb_threads = _nb_threads; }
+
 inline double OptimizerConfig::get_rel_eps_f() const                 { return rel_eps_f; }
 
 inline double OptimizerConfig::get_abs_eps_f() const                 { return abs_eps_f; }
@@ -224,6 +268,12 @@ inline bool OptimizerConfig::with_extended_cov()  const              { return ex
 
 inline bool OptimizerConfig::with_anticipated_upper_bounding() const { return anticipated_UB; }
 
+inline int OptimizerConfig::get_nb_threads() const                   { return nb_threads; }
+
+inline OptimizerConfig* OptimizerConfig::worker_config()             { return NULL; }
+
+inline double OptimizerConfig::get_random_seed()                     { return 0; }
+
 } /* namespace ibex */
 
 #endif /* __IBEX_OPTIMIZER_CONFIG_H__ */
@@ -21,6 +21,7 @@
 #include "ibex_CtcIdentity.h"
 #include "ibex_CellStack.h"
 #include "ibex_CellList.h"
+#include "ibex_CellDiskList.h"
 #include "ibex_Array.h"
 #include "ibex_Random.h"
 #include "ibex_NormalizedSystem.h"
@@ -56,6 +57,15 @@ System* get_square_eq_sys(Memory& memory, const System& sys) {
 	}
 }
 
+CellBuffer* get_cell_buffer(bool dfs, unsigned int bfs_max_cells_in_memory) {
+	if (dfs)
+		return new CellStack();
+	else if (bfs_max_cells_in_memory>0)
+		return new CellDiskList(bfs_max_cells_in_memory);
+	else
+		return new CellList();
+}
+
 } // end namespace
 
 // the corners for  Xnewton
@@ -99,30 +109,55 @@ Ctc* DefaultSolver::ctc (const System& sys, double prec) {
 }
 
 DefaultSolver::DefaultSolver(const System& sys, double eps_x_min, double eps_x_max,
-		bool dfs, double random_seed) : Solver(sys, rec(ctc(sys,eps_x_min)),
+		bool dfs, double random_seed, int nb_threads, unsigned int bfs_max_cells_in_memory) : Solver(sys, rec(ctc(sys,eps_x_min)),
 		get_square_eq_sys(*this, sys)!=NULL?
 				(Bsc&) rec(new SmearSumRelative(*get_square_eq_sys(*this, sys), eps_x_min)) :
 				(Bsc&) rec(new RoundRobin(eps_x_min)),
-				rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
+				rec(get_cell_buffer(dfs, bfs_max_cells_in_memory)),
 				Vector(sys.nb_var,eps_x_min), Vector(sys.nb_var,eps_x_max)),
 		sys(sys) {
 
 	RNG::srand(random_seed);
 
+	// the workers draw other sequences (see Solver::random_seed)
+	this->random_seed=random_seed;
+
+	add_workers(Vector(sys.nb_var,eps_x_min), eps_x_max, random_seed, nb_threads);
 }
 
 // Note: we set the precision for Newton to the minimum of the precisions.
 DefaultSolver::DefaultSolver(const System& sys, const Vector& eps_x_min, double eps_x_max,
-		bool dfs, double random_seed) : Solver(sys, rec(ctc(sys,eps_x_min.min())),
+		bool dfs, double random_seed, int nb_threads, unsigned int bfs_max_cells_in_memory) : Solver(sys, rec(ctc(sys,eps_x_min.min())),
 		get_square_eq_sys(*this, sys)!=NULL?
 				(Bsc&) rec(new SmearSumRelative(*get_square_eq_sys(*this, sys), eps_x_min)) :
 				(Bsc&) rec(new RoundRobin(eps_x_min)),
-		rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
+		rec(get_cell_buffer(dfs, bfs_max_cells_in_memory)),
 		eps_x_min, Vector(sys.nb_var,eps_x_max)),
 		sys(sys) {
 
 	RNG::srand(random_seed);
 
+	// the workers draw other sequences (see Solver::random_seed)
+	this->random_seed=random_seed;
+
+	add_workers(eps_x_min, eps_x_max, random_seed, nb_threads);
+}
+
+void DefaultSolver::add_workers(const Vector& eps_x_min, double eps_x_max, double random_seed, int nb_threads) {
+	// the system is shared (functions can be evaluated by
+	// concurrent threads) but each worker has its own contractors.
+	// The buffer of a worker is not used (see Solver::add_worker):
+	// a plain stack is enough.
+	for (int i=1; i<nb_threads; i++) {
+		DefaultSolver* w=new DefaultSolver(sys, eps_x_min, eps_x_max, true, random_seed, 1);
+		helpers.push_back(w);
+		add_worker(*w);
+	}
+}
+
+DefaultSolver::~DefaultSolver() {
+	for (vector<DefaultSolver*>::iterator it=helpers.begin(); it!=helpers.end(); ++it)
+		delete *it;
 }
 
 } // end namespace ibex
@@ -33,8 +33,15 @@ public:
 	 * \param eps_x_min - Criterion for stopping bisection (absolute precision)
 	 * \param eps_x_max - Criterion for forcing bisection  (absolute precision)
 	 * \param dfs       - true: depth-first search. false: breadth-first search
+	 * \param nb_threads - Number of threads (>1: parallel mode, see #Solver::add_worker(Solver&)).
+	 *                    The search is then depth-first in each thread (\a dfs and
+	 *                    \a bfs_max_cells_in_memory are ignored).
+	 * \param bfs_max_cells_in_memory - Memory budget of breadth-first search: maximal number of
+	 *                    cells kept in memory, the other ones being stored in a temporary file
+	 *                    (see #ibex::CellDiskList). 0 means no limit (the default).
 	 */
-    DefaultSolver(const System& sys, double eps_x_min=default_eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed);
+    DefaultSolver(const System& sys, double eps_x_min=default_eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed, int nb_threads=1,
+    		unsigned int bfs_max_cells_in_memory=0);
 
     /**
 	 * \brief Create a default solver.
@@ -44,8 +51,17 @@ public:
 	 *                    precisions, one for each variable)
 	 * \param eps_x_max - Criterion for forcing bisection  (absolute precision)
 	 * \param dfs       - true: depth-first search. false: breadth-first search
+	 * \param nb_threads - Number of threads (>1: parallel mode, see #Solver::add_worker(Solver&)).
+	 *                    The search is then depth-first in each thread (see above).
+	 * \param bfs_max_cells_in_memory - Memory budget of breadth-first search (see above).
 	 */
-    DefaultSolver(const System& sys, const Vector& eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed);
+    DefaultSolver(const System& sys, const Vector& eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed, int nb_threads=1,
+    		unsigned int bfs_max_cells_in_memory=0);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~DefaultSolver();
 
 	/**
 	 * \brief Default minimal width: 1e-6.
@@ -75,6 +91,17 @@ private:
 	 */
 	Ctc* ctc(const System& sys, double prec);
 
+	/**
+	 * Create the workers of the parallel mode, each one
+	 * with its own operators (the system is shared).
+	 */
+	void add_workers(const Vector& eps_x_min, double eps_x_max, double random_seed, int nb_threads);
+
+	/**
+	 * Workers (parallel mode)
+	 */
+	std::vector<DefaultSolver*> helpers;
+
 //	std::vector<CtcXNewton::corner_point>* default_corners ();
 
 };
@@ -13,9 +13,20 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_LinearException.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_Random.h"
 
 #include <cassert>
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <exception>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -27,8 +38,8 @@ namespace {
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0),
-		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL),
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), random_seed(0),
+		  profiler(NULL), solve_init_box(sys.box), eqs(NULL), ineqs(NULL), prof_ctc(NULL), prof_bsc(NULL),
 		  params(sys.nb_var,BitSet::empty(sys.nb_var),false) /* no forced parameter by default */,
 		  manif(NULL), time(0), old_time(0), nb_cells(0), old_nb_cells(0) {
 
@@ -67,6 +78,16 @@ void Solver::set_params(const VarSet& _params) {
 	params=_params;
 }
 
+void Solver::add_worker(Solver& worker) {
+#ifndef _WIN32
+	if (worker.n!=n || worker.m!=m || worker.nb_ineq!=nb_ineq)
+		ibex_error("[Solver] the worker does not solve the same system");
+	workers.push_back(&worker);
+#else
+	ibex_warning("[Solver] parallel mode not supported on this platform (worker ignored)");
+#endif
+}
+
 Solver::~Solver() {
 	if (ineqs) {
 		delete ineqs;
@@ -101,6 +122,8 @@ void Solver::start(const IntervalVector& init_box) {
 	time = 0;
 	manif->set_time(0);
 
+	prof_ctc = prof_bsc = NULL;
+
 	nb_cells = 1;
 	manif->set_nb_cells(0);
 
@@ -153,6 +176,8 @@ void Solver::start(const CovSolverData& data) {
 	time = 0;
 	manif->set_time(data.time());
 
+	prof_ctc = prof_bsc = NULL;
+
 	nb_cells=0; // no new cell created!
 	manif->set_nb_cells(data.nb_cells());
 
@@ -164,6 +189,37 @@ void Solver::start(const char* input_paving) {
 	start(data);
 }
 
+void Solver::contract(Cell& c, ContractContext& context) {
+	if (!profiler) {
+		ctc.contract(c.box,context);
+		return;
+	}
+
+	if (!prof_ctc) prof_ctc=&profiler->entry("contractor "+Profiler::type_name(typeid(ctc)));
+
+	IntervalVector before(c.box);
+	double t=Profiler::now();
+	ctc.contract(c.box,context);
+	profiler->add(*prof_ctc, Profiler::now()-t, before, c.box);
+}
+
+pair<Cell*,Cell*> Solver::bisect(Cell& c) {
+	if (!profiler)
+		return bsc.bisect(c);
+
+	if (!prof_bsc) prof_bsc=&profiler->entry("bisector "+Profiler::type_name(typeid(bsc)));
+
+	double t=Profiler::now();
+	try {
+		pair<Cell*,Cell*> p=bsc.bisect(c);
+		profiler->add(*prof_bsc, Profiler::now()-t);
+		return p;
+	} catch(NoBisectableVariableException&) {
+		profiler->add(*prof_bsc, Profiler::now()-t);
+		throw;
+	}
+}
+
 bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol) {
 
 	while (!buffer.empty()) {
@@ -192,7 +248,7 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 		}
 
 		try {
-			ctc.contract(c->box,context);
+			contract(*c,context);
 
 			if (c->box.is_empty()) throw EmptyBoxException();
 
@@ -213,7 +269,7 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 					throw NoBisectableVariableException();
 
 				// next line may also throw NoBisectableVariableException
-				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+				pair<Cell*,Cell*> new_cells=bisect(*c);
 
 				delete buffer.pop();
 				// note: more natural to push first the second, so that
@@ -280,8 +336,16 @@ Solver::Status Solver::solve(bool stop_at_first) {
 
 	CovSolverData::BoxStatus status;
 
+	// the sub-contractors are profiled during the search only
+	CtcProfilerScope profiling(profiler);
+	profiling.add(ctc);
+	for (vector<Solver*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		profiling.add((*it)->ctc);
+
 	try {
-		while (next(status)) {
+		if (!workers.empty())
+			final_status=solve_parallel(stop_at_first, final_status);
+		else while (next(status)) {
 			if (final_status==INFEASIBLE) // first solution found
 				final_status=SUCCESS; // by default... may be changed right after
 
@@ -488,6 +552,293 @@ void Solver::flush() {
 	}
 }
 
+#ifndef _WIN32
+
+namespace {
+
+/*
+ * Cells owned by a thread in parallel mode.
+ *
+ * The owner pushes and pops cells at the back (depth-first search)
+ * while idle threads steal the oldest (largest) cells at the front.
+ */
+class CellDeque {
+public:
+	void push(Cell* c) {
+		lock_guard<mutex> lock(mtx);
+		cells.push_back(c);
+	}
+
+	Cell* pop() {
+		lock_guard<mutex> lock(mtx);
+		if (cells.empty()) return NULL;
+		Cell* c=cells.back();
+		cells.pop_back();
+		return c;
+	}
+
+	Cell* steal() {
+		lock_guard<mutex> lock(mtx);
+		if (cells.empty()) return NULL;
+		Cell* c=cells.front();
+		cells.pop_front();
+		return c;
+	}
+
+private:
+	std::deque<Cell*> cells;
+	mutex mtx;
+};
+
+// value of ParallelSearch::halt while the search is running
+const int RUNNING=-1;
+
+} // end anonymous namespace
+
+struct Solver::ParallelSearch {
+
+	ParallelSearch(int nb_threads) : cells(nb_threads), alive(0), nb_cells(0),
+			halt(RUNNING), start(chrono::steady_clock::now()) { }
+
+	/*
+	 * Stop all the threads with the given status
+	 * (only the first call has an effect).
+	 */
+	void stop(Status status) {
+		int running=RUNNING;
+		halt.compare_exchange_strong(running, (int) status);
+	}
+
+	double elapsed() const {
+		return chrono::duration<double>(chrono::steady_clock::now()-start).count();
+	}
+
+	// one deque per thread
+	vector<CellDeque> cells;
+
+	// number of cells either in a deque or being processed
+	atomic<long> alive;
+
+	// number of cells created so far (including
+	// those counted before the parallel search started)
+	atomic<unsigned long> nb_cells;
+
+	// RUNNING or the status that stopped the search
+	atomic<int> halt;
+
+	chrono::steady_clock::time_point start;
+
+	// first exception raised by a thread (if any)
+	exception_ptr error;
+	mutex error_mtx;
+};
+
+Solver::Status Solver::solve_parallel(bool stop_at_first, Status final_status) {
+
+	int nb_threads=workers.size()+1;
+
+	ParallelSearch search(nb_threads);
+	search.nb_cells=nb_cells;
+
+	// The workers inherit the settings of this solver
+	// and record their boxes in a fresh structure.
+	for (vector<Solver*>::iterator it=workers.begin(); it!=workers.end(); ++it) {
+		Solver& w=**it;
+		w.boundary_test=boundary_test;
+		w.params=params;
+		w.trace=trace;
+		w.random_seed=random_seed;
+		w.cell_limit=cell_limit;
+		w.time_limit=time_limit;
+		w.profiler=profiler;
+		w.prof_ctc=w.prof_bsc=NULL;
+		w.solve_init_box=solve_init_box;
+		if (w.manif) delete w.manif;
+		w.manif=new CovSolverData(n, m, nb_ineq);
+	}
+
+	size_t nb_unknown_before=manif->nb_unknown();
+	size_t size_before=manif->size();
+
+	// cells to be processed (root cell or unknown boxes of a COV)
+	// are handed to the first thread. The others will steal them.
+	while (!buffer.empty()) {
+		search.cells[0].push(buffer.pop());
+		search.alive++;
+	}
+
+	vector<thread> threads;
+	for (int k=1; k<nb_threads; k++)
+		threads.push_back(thread(&Solver::run_worker, workers[k-1], k, ref(search), stop_at_first));
+
+	run_worker(0, search, stop_at_first);
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	nb_cells=search.nb_cells;
+
+	for (vector<Solver*>::iterator it=workers.begin(); it!=workers.end(); ++it) {
+		merge(*(*it)->manif);
+		delete (*it)->manif;
+		(*it)->manif=NULL;
+	}
+
+	// the remaining cells are pending boxes
+	bool pending=false;
+	for (int k=0; k<nb_threads; k++) {
+		Cell* c;
+		while ((c=search.cells[k].pop())!=NULL) {
+			if (trace >=1) cout << " [pending] " << c->box << endl;
+			manif->add_pending(c->box);
+			delete c;
+			pending=true;
+		}
+	}
+
+	if (search.error)
+		rethrow_exception(search.error);
+
+	if (manif->size()>size_before && final_status==INFEASIBLE)
+		final_status=SUCCESS;
+
+	if (manif->nb_unknown()>nb_unknown_before)
+		final_status=NOT_ALL_VALIDATED;
+
+	// as in next(...), a search that stopped with
+	// no cell left is not interrupted (the limit may
+	// have been reached right after the last cell)
+	if (search.halt!=RUNNING && pending)
+		final_status=(Status) search.halt.load();
+
+	return final_status;
+}
+
+void Solver::run_worker(int k, ParallelSearch& search, bool stop_at_first) {
+
+	int nb_threads=search.cells.size();
+
+	// the random number generator is thread local
+	if (k>0) RNG::srand((int) (random_seed+k));
+
+	try {
+		while (search.halt==RUNNING) {
+
+			if (search.alive==0) break; // search is over
+
+			// only the first thread checks the time
+			// (avoid concurrent calls to the timer)
+			if (k==0 && time_limit>0 && search.elapsed()>=time_limit) {
+				search.stop(TIME_OUT);
+				break;
+			}
+
+			Cell* c=search.cells[k].pop();
+
+			if (!c) {
+				for (int i=1; i<nb_threads && !c; i++)
+					c=search.cells[(k+i)%nb_threads].steal();
+
+				if (!c) {
+					if (search.alive==0) break; // search is over
+					this_thread::yield();
+					continue;
+				}
+
+				// a stolen cell may lack the properties
+				// required by the operators of this thread.
+				bsc.add_property(c->box, c->prop);
+				ctc.add_property(c->box, c->prop);
+				buffer.add_property(c->box, c->prop);
+			}
+
+			bool found=false; // new output box?
+
+			ContractContext context(c->prop);
+
+			if (c->bisected_var!=-1) // not the root node
+				context.impact = BitSet::singleton(n,c->bisected_var);
+
+			try {
+				contract(*c,context);
+
+				if (c->box.is_empty()) throw EmptyBoxException();
+
+				// see next(...)
+				if (m==0 || (m<n && !is_too_large(c->box)))
+					found = check_sol(c->box)!=CovSolverData::UNKNOWN;
+
+				if (!found) {
+					try {
+						if (is_too_small(c->box))
+							throw NoBisectableVariableException();
+
+						pair<Cell*,Cell*> new_cells=bisect(*c);
+
+						// note: the parent is still counted (until it is deleted)
+						// so "alive" cannot fall to zero in the meantime.
+						search.alive+=2;
+						search.cells[k].push(new_cells.second);
+						search.cells[k].push(new_cells.first);
+
+						unsigned long nb=(search.nb_cells+=2);
+						if (cell_limit >=0 && nb>=(unsigned long) cell_limit)
+							search.stop(CELL_OVERFLOW);
+					}
+					catch (NoBisectableVariableException&) {
+						if (check_sol(c->box)==CovSolverData::UNKNOWN) {
+							if (trace >=1) cout << " [unknown] " << c->box << endl;
+							manif->add_unknown(c->box);
+						}
+						found=true;
+					}
+				}
+			}
+			catch (EmptyBoxException&) { }
+
+			delete c;
+			search.alive--;
+
+			if (found && stop_at_first)
+				search.stop(USER_BREAK);
+		}
+	} catch(...) {
+		lock_guard<mutex> lock(search.error_mtx);
+		if (!search.error) search.error=current_exception();
+		search.stop(USER_BREAK);
+	}
+}
+
+void Solver::merge(const CovSolverData& data) {
+
+	for (size_t i=0; i<data.nb_inner(); i++)
+		manif->add_inner(data.inner(i));
+
+	// without equalities, the solutions are the inner boxes
+	if (m>0) {
+		for (size_t i=0; i<data.nb_solution(); i++)
+			if (m==n)
+				manif->add_solution(data.solution(i), data.unicity(i));
+			else
+				manif->add_solution(data.solution(i), data.unicity(i), data.solution_varset(i));
+	}
+
+	for (size_t i=0; i<data.nb_boundary(); i++)
+		manif->add_boundary(data.boundary(i), data.boundary_varset(i));
+
+	for (size_t i=0; i<data.nb_unknown(); i++)
+		manif->add_unknown(data.unknown(i));
+}
+
+#else
+
+Solver::Status Solver::solve_parallel(bool stop_at_first, Status final_status) {
+	not_implemented("parallel mode on this platform");
+	return final_status;
+}
+
+#endif
+
 namespace {
 const char* green() {
 #ifndef _WIN32
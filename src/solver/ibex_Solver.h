@@ -20,6 +20,7 @@
 #include "ibex_Exception.h"
 #include "ibex_Linear.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_Profiler.h"
 
 #include <vector>
 
@@ -81,6 +82,29 @@ public:
 	 */
 	void set_params(const VarSet& params);
 
+	/**
+	 * \brief Add a worker for the parallel mode.
+	 *
+	 * The worker is another solver for the same system, with its own
+	 * contractor, bisector and buffer (the system itself can be shared:
+	 * functions can be evaluated by concurrent threads). Once at least one
+	 * worker is added, solve(...) explores the search tree with one thread
+	 * per solver (this solver included). Each thread owns a deque of cells
+	 * and, when idle, steals the oldest cells of the other threads.
+	 *
+	 * The parameters of the search (boundary test, forced parameters, trace,
+	 * limits) are those of this solver. The boxes found by all the threads
+	 * are merged in the data of this solver (see #get_data()).
+	 *
+	 * The search is depth-first in each thread, whatever the buffers: the
+	 * buffer of this solver only hands the initial cells to the threads
+	 * and the buffers of the workers are not used. In particular,
+	 * breadth-first search is not supported in parallel mode.
+	 *
+	 * Note: the interactive mode (see #next(...)) is always sequential.
+	 */
+	void add_worker(Solver& worker);
+
 	/**
 	 * \brief Destructor.
 	 */
@@ -256,6 +280,9 @@ public:
 	 *
 	 * This parameter allows to bound running time.
 	 * The value can be fixed by the user. By default, it is -1 (no limit).
+	 *
+	 * In parallel mode (see #add_worker(Solver&)), the limit applies
+	 * to the elapsed (wall-clock) time.
 	 */
 
 	double time_limit;
@@ -279,6 +306,27 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Seed of the random number generators of the workers.
+	 *
+	 * In parallel mode (see #add_worker(Solver&)), the k-th additional
+	 * thread (k>=1) seeds its generator with random_seed+k, so that two
+	 * threads do not draw the same sequence. The generator of the calling
+	 * thread is left untouched. By default, 0.
+	 */
+	double random_seed;
+
+	/**
+	 * \brief Profiler (opt-in instrumentation).
+	 *
+	 * If not NULL, the calls to the contractor (and to all its
+	 * sub-contractors, see #ibex::CtcProfiler::instrument) and to the
+	 * bisector are recorded in this profiler during solve(...).
+	 * In parallel mode, the workers feed the same profiler.
+	 *
+	 * The profiler is not owned by the solver. By default, it is NULL.
+	 */
+	Profiler* profiler;
 
 protected:
 	/**
@@ -318,11 +366,41 @@ protected:
 
 	bool check_ineq(const IntervalVector& box);
 
+	/**
+	 * \brief Contract a cell (recorded by the profiler, if any).
+	 */
+	void contract(Cell& c, ContractContext& context);
+
+	/**
+	 * \brief Bisect a cell (recorded by the profiler, if any).
+	 */
+	std::pair<Cell*,Cell*> bisect(Cell& c);
+
 	/**
 	 * \brief Check if time is out.
 	 */
 	void time_limit_check();
 
+	/*
+	 * \brief Data shared by the threads in parallel mode.
+	 */
+	struct ParallelSearch;
+
+	/**
+	 * \brief Call "next" until search is over, with all the workers.
+	 */
+	Status solve_parallel(bool stop_at_first, Status final_status);
+
+	/**
+	 * \brief Main loop of the kth thread in parallel mode.
+	 */
+	void run_worker(int k, ParallelSearch& search, bool stop_at_first);
+
+	/*
+	 * \brief Merge the boxes found by a worker into this solver's data.
+	 */
+	void merge(const CovSolverData& data);
+
 	/*
 	 * \brief Initial box of the current search.
 	 */
@@ -353,6 +431,12 @@ protected:
 	 */
 	const System* ineqs;
 
+	/*
+	 * \brief Entries of the profiler (NULL if not created yet).
+	 */
+	Profiler::Entry* prof_ctc;
+	Profiler::Entry* prof_bsc;
+
 	/**
 	 * \brief The forced parameters (if any, NULL otherwise).
 	 */
@@ -384,6 +468,11 @@ protected:
 	 * \brief Number of cells of the previous call.
 	 */
 	unsigned int old_nb_cells;
+
+	/**
+	 * \brief Other solvers used in parallel mode (empty by default).
+	 */
+	std::vector<Solver*> workers;
 };
 
 /*============================================ inline implementation ============================================ */
@@ -0,0 +1,56 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Bxp.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Bxp.h"
+#include "ibex_BlockPool.h"
+
+namespace ibex {
+
+namespace {
+
+// size classes: 16, 32, ..., 256 bytes
+const size_t granularity = 16;
+const size_t nb_classes = 16;
+
+// Set once the pools of the thread are destroyed
+// (see the pools of ibex_Cell.cpp).
+thread_local bool pools_destroyed=false;
+
+struct BxpPools {
+	~BxpPools() { pools_destroyed=true; }
+
+	BlockPool classes[nb_classes];
+};
+
+// note: the value of a subclass is released with its
+// dynamic size (the destructor of Bxp is virtual)
+thread_local BxpPools bxp_pools = { {
+		{16},  {32},  {48},  {64},  {80},  {96},  {112}, {128},
+		{144}, {160}, {176}, {192}, {208}, {224}, {240}, {256}
+} };
+
+} // end anonymous namespace
+
+void* Bxp::operator new(size_t size) {
+	size_t i=(size-1)/granularity;
+	if (i>=nb_classes || pools_destroyed)
+		return ::operator new(size);
+	return bxp_pools.classes[i].alloc();
+}
+
+void Bxp::operator delete(void* p, size_t size) {
+	if (!p) return;
+
+	size_t i=(size-1)/granularity;
+	if (i>=nb_classes || pools_destroyed)
+		::operator delete(p);
+	else
+		bxp_pools.classes[i].free(p);
+}
+
+} // end namespace ibex
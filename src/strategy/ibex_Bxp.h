@@ -86,6 +86,20 @@ public:
 	 */
 	virtual ~Bxp();
 
+	/**
+	 * \brief Allocate a property value.
+	 *
+	 * Property values are created and deleted with every cell. Small
+	 * values (up to 256 bytes) are recycled through per-thread free
+	 * lists, one per size class, like cells (see Cell::operator new).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Release a property value (to the free lists of the calling thread).
+	 */
+	static void operator delete(void* p, size_t size);
+
 	/**
 	 * \brief Identifying number.
 	 */
@@ -10,6 +10,8 @@
 #include "ibex_BxpActiveCtr.h"
 #include "ibex_Id.h"
 
+#include <mutex>
+
 using namespace std;
 
 namespace ibex {
@@ -49,6 +51,10 @@ void BxpActiveCtr::update(const BoxEvent& e, const BoxProperties& prop) {
 }
 
 long BxpActiveCtr::get_id(const NumConstraint& ctr) {
+	// the map is shared by the threads of a parallel search
+	static mutex ids_mutex;
+	lock_guard<mutex> lock(ids_mutex);
+
 	try {
 		return ids()[ctr.id];
 	} catch(Map<long,long,false>::NotFound&) {
@@ -10,6 +10,8 @@
 #include "ibex_BxpActiveCtrs.h"
 #include "ibex_Id.h"
 
+#include <mutex>
+
 using namespace std;
 
 namespace ibex {
@@ -68,6 +70,10 @@ void BxpActiveCtrs::_update(const BoxProperties& prop) {
 }
 
 long BxpActiveCtrs::get_id(const System& sys) {
+	// the map is shared by the threads of a parallel search
+	static mutex ids_mutex;
+	lock_guard<mutex> lock(ids_mutex);
+
 	try {
 		return ids()[sys.id];
 	} catch(Map<long,long,false>::NotFound&) {
@@ -12,6 +12,8 @@
 #include "ibex_NormalizedSystem.h"
 #include "ibex_ExtendedSystem.h"
 
+#include <mutex>
+
 using namespace std;
 
 namespace ibex {
@@ -71,6 +73,10 @@ string BxpLinearRelaxArgMin::to_string() const {
 }
 
 long BxpLinearRelaxArgMin::get_id(const System& sys) {
+	// the map is shared by the threads of a parallel search
+	static mutex ids_mutex;
+	lock_guard<mutex> lock(ids_mutex);
+
 	const NormalizedSystem* norm_sys = dynamic_cast<const NormalizedSystem*>(&sys);
 	long sys_id = norm_sys? norm_sys->original_sys_id : sys.id;
 	try {
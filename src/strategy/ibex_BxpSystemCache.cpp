@@ -12,6 +12,7 @@
 #include "ibex_Id.h"
 
 #include <cassert>
+#include <mutex>
 
 using namespace std;
 
@@ -55,6 +56,10 @@ BxpSystemCache* BxpSystemCache::copy(const IntervalVector& box, const BoxPropert
 }
 
 long BxpSystemCache::get_id(const System& sys) {
+	// the map is shared by the threads of a parallel search
+	static mutex ids_mutex;
+	lock_guard<mutex> lock(ids_mutex);
+
 	try {
 		return ids()[sys.id];
 	} catch(Map<long,long,false>::NotFound&) {
@@ -281,7 +286,7 @@ IntervalMatrix BxpSystemCache::active_ctrs_jacobian() const {
 	IntervalMatrix J(b.size(),nb_var);
 
 	if (!active_ctr_jacobian_updated) {
-		J=sys.f_ctrs.jacobian(cache,b);
+		sys.f_ctrs.jacobian(cache,J,b);
 
 		int c;
 		for (int i=0; i<b.size(); i++) {
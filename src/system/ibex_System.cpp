@@ -331,11 +331,23 @@ IntervalMatrix System::active_ctrs_jacobian(const IntervalVector& box) const {
 
 	IntervalMatrix J(b.size(),nb_var);
 
-	J=f_ctrs.jacobian(box,b);
+	f_ctrs.jacobian(box,J,b);
 
 	return J;
 }
 
+void System::goal_ub_batch(const Matrix& pts, Vector& ub) const {
+	assert(pts.nb_rows()==nb_var);
+	assert(ub.size()==pts.nb_cols());
+
+	IntervalVector fx(pts.nb_cols());
+	goal->eval_batch(IntervalMatrix(pts), fx);
+
+	for (int j=0; j<pts.nb_cols(); j++)
+		// empty means: outside of the definition domain of the function
+		ub[j] = fx[j].is_empty() ? POS_INFINITY : fx[j].ub();
+}
+
 bool System::is_inner(const IntervalVector& box) const {
 
 	return active_ctrs(box).empty();
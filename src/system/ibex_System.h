@@ -126,6 +126,17 @@ public:
 	 */
 	double goal_ub(const Vector& x) const;
 
+	/**
+	 * \brief The upper bounds of the goal at N points.
+	 *
+	 * \param pts - the points, in structure-of-arrays layout: a nb_var x N
+	 *              matrix, the jth column being the jth point.
+	 * \param ub  - (output) vector of size N: ub[j] is goal_ub(jth point).
+	 *
+	 * The N evaluations are performed at once (see #Function::eval_batch()).
+	 */
+	void goal_ub_batch(const Matrix& pts, Vector& ub) const;
+
 	/**
 	 * \brief Interval evaluation of the goal.
 	 */
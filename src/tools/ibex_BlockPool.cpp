@@ -0,0 +1,57 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BlockPool.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#include "ibex_BlockPool.h"
+
+#include <new>
+#include <cassert>
+
+namespace ibex {
+
+constexpr size_t BlockPool::default_max_size;
+
+BlockPool::BlockPool(size_t block_size, size_t max_size) : block_size(block_size), max_size(max_size),
+		head(NULL), _size(0) {
+	assert(block_size>=sizeof(void*));
+}
+
+BlockPool::~BlockPool() {
+	clear();
+}
+
+void* BlockPool::alloc() {
+	if (!head)
+		return ::operator new(block_size);
+
+	void* p=head;
+	head=*((void**) p);
+	_size--;
+	return p;
+}
+
+void BlockPool::free(void* p) {
+	if (_size>=max_size) {
+		::operator delete(p);
+		return;
+	}
+
+	*((void**) p)=head;
+	head=p;
+	_size++;
+}
+
+void BlockPool::clear() {
+	while (head) {
+		void* next=*((void**) head);
+		::operator delete(head);
+		head=next;
+	}
+	_size=0;
+}
+
+} // end namespace ibex
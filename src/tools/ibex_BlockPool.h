@@ -0,0 +1,100 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BlockPool.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_BLOCK_POOL_H__
+#define __IBEX_BLOCK_POOL_H__
+
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Free list of memory blocks of the same size.
+ *
+ * A released block is kept for the next allocation instead of
+ * going back to the system allocator, unless the list already
+ * holds \a max_size blocks.
+ *
+ * A pool is not thread-safe: it is meant to be declared thread_local.
+ * A block can be released in the pool of another thread than the one it
+ * was allocated from (e.g., a cell stolen in a parallel search): the memory
+ * simply changes hands. The bound on the size of the list prevents a thread
+ * that releases more blocks than it allocates from hoarding memory.
+ */
+class BlockPool {
+public:
+	/**
+	 * \brief Create an empty pool.
+	 *
+	 * \param block_size - size in bytes of a block (at least the size of a pointer)
+	 * \param max_size   - maximal number of free blocks.
+	 */
+	BlockPool(size_t block_size, size_t max_size=default_max_size);
+
+	/**
+	 * \brief Delete this (the free blocks go back to the system).
+	 */
+	~BlockPool();
+
+	/**
+	 * \brief Allocate a block.
+	 */
+	void* alloc();
+
+	/**
+	 * \brief Release a block.
+	 */
+	void free(void* p);
+
+	/**
+	 * \brief Number of free blocks.
+	 */
+	size_t size() const;
+
+	/**
+	 * \brief Give the free blocks back to the system.
+	 */
+	void clear();
+
+	/**
+	 * \brief Size in bytes of a block.
+	 */
+	const size_t block_size;
+
+	/**
+	 * \brief Maximal number of free blocks.
+	 */
+	const size_t max_size;
+
+	/**
+	 * \brief Default maximal number of free blocks.
+	 */
+	static constexpr size_t default_max_size = 4096;
+
+private:
+	BlockPool(const BlockPool&) = delete;
+	BlockPool& operator=(const BlockPool&) = delete;
+
+	/* Free blocks, chained through their first word. */
+	void* head;
+
+	/* Number of free blocks. */
+	size_t _size;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline size_t BlockPool::size() const {
+	return _size;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_BLOCK_POOL_H__
@@ -11,9 +11,59 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <algorithm>
 
 namespace ibex {
 
+namespace {
+
+std::vector<std::pair<int,int> > swap_pairs(const std::vector<std::pair<int,int> >& arcs) {
+	std::vector<std::pair<int,int> > res;
+	res.reserve(arcs.size());
+	for (std::vector<std::pair<int,int> >::const_iterator it=arcs.begin(); it!=arcs.end(); ++it)
+		res.push_back(std::make_pair(it->second, it->first));
+	return res;
+}
+
+}
+
+void DirectedHyperGraph::Adj::build(int nb_nodes, std::vector<std::pair<int,int> >& arcs) {
+	std::sort(arcs.begin(), arcs.end());
+	arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+
+	start = new int[nb_nodes+1];
+	index = new int[arcs.size()];
+
+	int k=0;
+	for (int i=0; i<nb_nodes; i++) {
+		start[i]=k;
+		while (k<(int) arcs.size() && arcs[k].first==i) {
+			index[k]=arcs[k].second;
+			k++;
+		}
+	}
+	start[nb_nodes]=k;
+	assert(k==(int) arcs.size());
+}
+
+void DirectedHyperGraph::build() {
+	assert(!built);
+
+	std::vector<std::pair<int,int> > arcs=swap_pairs(in_arcs);
+	var_output_adj.build(n, arcs);
+	ctr_input_adj.build(m, in_arcs);
+
+	arcs=swap_pairs(out_arcs);
+	var_input_adj.build(n, arcs);
+	ctr_output_adj.build(m, out_arcs);
+
+	// release the memory
+	std::vector<std::pair<int,int> >().swap(in_arcs);
+	std::vector<std::pair<int,int> >().swap(out_arcs);
+
+	built=true;
+}
+
 std::ostream& operator<<(std::ostream& os, const DirectedHyperGraph& g) {
 	for (int c=0; c<g.m; c++) {
 		os << "ctr " << c << " input=( ";
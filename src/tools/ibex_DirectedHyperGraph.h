@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Directed hyper-graph (represented by an adjacency matrix)
+ * I B E X - Directed hyper-graph (represented by compressed adjacency lists)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -13,7 +13,9 @@
 #define __IBEX_DIRECTED_HYPER_GRAPH_H__
 
 #include <iostream>
-#include <set>
+#include <vector>
+#include <utility>
+#include <cassert>
 
 namespace ibex {
 
@@ -21,16 +23,49 @@ namespace ibex {
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The graph is built in two steps: the arcs are first added
+ * with #add_arc(), then #build() turns the graph into an immutable
+ * structure where the adjacency lists are stored contiguously
+ * ("compressed sparse row" format). Iterating over the neighbors of
+ * a constraint or a variable does not allocate memory.
  */
 class DirectedHyperGraph {
 public:
+
+	/**
+	 * \brief Sorted list of constraints or variables (adjacency list).
+	 *
+	 * Only valid while the graph exists.
+	 */
+	class Range {
+	public:
+		/** \brief Create the list [first,last). */
+		Range(const int* first, const int* last);
+
+		/** \brief First element. */
+		const int* begin() const;
+
+		/** \brief Past-the-end element. */
+		const int* end() const;
+
+		/** \brief Number of elements. */
+		int size() const;
+
+		/** \brief True iff the list is empty. */
+		bool empty() const;
+
+	private:
+		const int* first;
+		const int* last;
+	};
+
 	/**
 	 * \brief Build a new directed hyper-graph.
 	 *
 	 */
 	DirectedHyperGraph(int nb_ctr, int nb_var);
 
-		/**
+	/**
 	 * \brief Delete the graph.
 	 */
 	~DirectedHyperGraph();
@@ -51,34 +86,45 @@ public:
 	 * \param incoming True iff \a var is an incoming variable
 	 * (the arc is var->ctr). Otherwise, \a var is outgoing (the
 	 * arc is var<-ctr).
+	 *
+	 * \pre #build() has not been called yet.
 	 */
 	void add_arc(int ctr, int var, bool incoming);
 
+	/**
+	 * \brief Build the adjacency lists.
+	 *
+	 * Must be called once all the arcs have been added and
+	 * before the adjacency lists are accessed. Duplicated
+	 * arcs are removed.
+	 */
+	void build();
+
 	/**
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	 Range input_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	 Range output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	 Range input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	 Range output_ctrs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -90,29 +136,72 @@ public:
 private:
 	DirectedHyperGraph(const DirectedHyperGraph&);
 
+	/*
+	 * Compressed adjacency lists: the neighbors of node i are
+	 * index[start[i]], ..., index[start[i+1]-1] (sorted).
+	 */
+	struct Adj {
+		Adj();
+		~Adj();
+		void build(int nb_nodes, std::vector<std::pair<int,int> >& arcs);
+		Range operator[](int i) const;
+
+		int* start;
+		int* index;
+	};
+
 	const int m;
 	const int n;
-	std::set<int> *ctr_input_adj;
-	std::set<int> *ctr_output_adj;
-	std::set<int> *var_input_adj;
-	std::set<int> *var_output_adj;
+	bool built;
+
+	// arcs (ctr,var) added so far (cleared by build())
+	std::vector<std::pair<int,int> > in_arcs;
+	std::vector<std::pair<int,int> > out_arcs;
+
+	Adj ctr_input_adj;
+	Adj ctr_output_adj;
+	Adj var_input_adj;
+	Adj var_output_adj;
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
+inline DirectedHyperGraph::Range::Range(const int* first, const int* last) : first(first), last(last) {
+}
+
+inline const int* DirectedHyperGraph::Range::begin() const {
+	return first;
+}
+
+inline const int* DirectedHyperGraph::Range::end() const {
+	return last;
+}
+
+inline int DirectedHyperGraph::Range::size() const {
+	return (int) (last-first);
+}
+
+inline bool DirectedHyperGraph::Range::empty() const {
+	return first==last;
+}
+
+inline DirectedHyperGraph::Adj::Adj() : start(NULL), index(NULL) {
+}
+
+inline DirectedHyperGraph::Adj::~Adj() {
+	delete[] start;
+	delete[] index;
+}
+
+inline DirectedHyperGraph::Range DirectedHyperGraph::Adj::operator[](int i) const {
+	return Range(index+start[i], index+start[i+1]);
+}
+
+inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var), built(false) {
 }
 
 inline DirectedHyperGraph::~DirectedHyperGraph() {
-	delete[] ctr_input_adj;
-	delete[] ctr_output_adj;
-	delete[] var_input_adj;
-	delete[] var_output_adj;
 }
 
 inline int DirectedHyperGraph::nb_ctr() const {
@@ -124,28 +213,30 @@ inline int DirectedHyperGraph::nb_var() const {
 }
 
 inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
-	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
-	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
-	}
+	assert(!built);
+	if (incoming)
+		in_arcs.push_back(std::make_pair(ctr,var));
+	else
+		out_arcs.push_back(std::make_pair(ctr,var));
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
+inline DirectedHyperGraph::Range DirectedHyperGraph::input_vars(int ctr) const {
+	assert(built);
 	return ctr_input_adj[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
+inline DirectedHyperGraph::Range DirectedHyperGraph::output_vars(int ctr) const {
+	assert(built);
 	return ctr_output_adj[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
+inline DirectedHyperGraph::Range DirectedHyperGraph::input_ctrs(int var) const {
+	assert(built);
 	return var_input_adj[var];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
+inline DirectedHyperGraph::Range DirectedHyperGraph::output_ctrs(int var) const {
+	assert(built);
 	return var_output_adj[var];
 }
 
@@ -112,6 +112,14 @@ public:
 	 *
 	 * The costs of the first heap are assumed to be up-to-date.
 	 *
+	 * The data to be removed are found in an auxiliary heap sorted by
+	 * decreasing first cost, so that the complexity is O(p*log(n)) where p
+	 * is the number of removed data (and O(n) if p is a significant
+	 * fraction of n). If the costs of the second heap
+	 * have to be recalculated (update_cost2_when_sorting), the second heap
+	 * is only sorted (in linear time) when it is accessed again, so that
+	 * successive contractions are done in a row.
+	 *
 	 * TODO: in principle we should implement the symmetric
 	 * case where the contraction is performed with respect
 	 * to the cost of the second heap.
@@ -145,26 +153,40 @@ protected:
 	mutable int current_heap_id;
 
 	/**
-	 * Used in the contract function by recursivity
-	 *
-	 * \param heap: the new heap1 under construction (will
-	 *        eventually replace the current heap1).
+	 * Update the first costs of all the data (if update_cost1_when_sorting
+	 * is true) and sort the first heap.
 	 */
-	void contract_rec(double new_loup, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate);
+	void sort1();
+
+	/**
+	 * Sort the second heap if a sort is pending (see #contract()).
+	 * Must be called before accessing heap2.
+	 */
+	void update2() const;
 
 private:
 	/**
-	 * Erase all the subnodes of node (including itself) in the first heap
-	 * and manage the impact on the second heap.
-	 * If "percolate" is true, the second heap is left in a correct state.
-	 * Otherwise, the second heap has a binary tree structure but not sorted
-	 * anymore. Therefore, "sort" should be called on the second heap.
+	 * Auxiliary heap with the opposite of the first cost,
+	 * i.e., the data with the largest first cost on top.
+	 */
+	SharedHeap<T> *heap_max1;
+
+	/** Whether the second heap has to be sorted (see contract). */
+	mutable bool sort2_pending;
+
+	/**
+	 * In #contract(), when more than size/bulk_ratio data have to be
+	 * removed, all the heaps are rebuilt (in linear time) instead.
+	 */
+	static const unsigned int bulk_ratio = 64;
+
+	/**
+	 * Remove (and delete) all the data with a first cost
+	 * greater than \a loup1 and rebuild the heaps.
 	 *
-	 * So the heap structure is maintained for the second heap
-	 * but not the first one. The reason is that this function is called
-	 * either by "contract" or "flush". "contract" will build a new heap from scratch.
+	 * Complexity: O(size)
 	 */
-	void erase_subnodes(HeapNode<T>* node, bool percolate);
+	void remove_all_sup(double loup1);
 
 	std::ostream& print(std::ostream& os) const;
 };
@@ -176,20 +198,31 @@ template<class T>
 DoubleHeap<T>::DoubleHeap(CostFunc<T>& cost1, bool update_cost1_when_sorting, CostFunc<T>& cost2, bool update_cost2_when_sorting, int critpr) :
 		 nb_nodes(0), heap1(new SharedHeap<T>(cost1,update_cost1_when_sorting,0)),
 		              heap2(new SharedHeap<T>(cost2,update_cost2_when_sorting,1)),
-		              critpr(critpr), current_heap_id(0) {
+		              critpr(critpr), current_heap_id(0),
+		              heap_max1(new SharedHeap<T>(cost1,false,2)), sort2_pending(false) {
 
 }
 
 template<class T>
 DoubleHeap<T>::DoubleHeap(const DoubleHeap &dhcp, bool deep_copy) :
-nb_nodes(dhcp.nb_nodes), heap1(NULL), heap2(NULL), critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id) {
+nb_nodes(dhcp.nb_nodes), heap1(NULL), heap2(NULL), critpr(dhcp.critpr), current_heap_id(dhcp.current_heap_id),
+heap_max1(NULL), sort2_pending(dhcp.sort2_pending) {
 	heap1 = new SharedHeap<T>(*dhcp.heap1, 2, deep_copy);
-	std::vector<HeapElt<T>*> p = heap1->elt();
 	heap2 = new SharedHeap<T>(dhcp.heap2->costf, dhcp.heap2->update_cost_when_sorting, dhcp.heap2->heap_id);
-
-	while(!p.empty()) {
-		heap2->push_elt(p.back());
-		p.pop_back();
+	heap_max1 = new SharedHeap<T>(dhcp.heap_max1->costf, false, dhcp.heap_max1->heap_id);
+
+	// the copies of the other heaps have the same structure: the
+	// copy of an element is found at the same position in heap1
+	heap2->l.reserve(nb_nodes);
+	heap_max1->l.reserve(nb_nodes);
+	for (unsigned int i=0; i<nb_nodes; i++) {
+		HeapElt<T>* elt = heap1->l[dhcp.heap2->l[i]->index[0]];
+		heap2->l.push_back(elt);
+		elt->index[1] = i;
+
+		elt = heap1->l[dhcp.heap_max1->l[i]->index[0]];
+		heap_max1->l.push_back(elt);
+		elt->index[2] = i;
 	}
 }
 
@@ -198,6 +231,7 @@ DoubleHeap<T>::~DoubleHeap() {
 	clear(); // what for?
 	if (heap1) delete heap1;
 	if (heap2) delete heap2;
+	delete heap_max1;
 
 }
 
@@ -205,6 +239,7 @@ template<class T>
 void DoubleHeap<T>::flush() {
 	if (nb_nodes>0) {
 		heap1->clear(SharedHeap<T>::NODE);
+		heap_max1->clear(SharedHeap<T>::NODE);
 		heap2->clear(SharedHeap<T>::NODE_ELT_DATA);
 		nb_nodes=0;
 	}
@@ -214,6 +249,7 @@ template<class T>
 void DoubleHeap<T>::clear() {
 	if (nb_nodes>0) {
 		heap1->clear(SharedHeap<T>::NODE);
+		heap_max1->clear(SharedHeap<T>::NODE);
 		heap2->clear(SharedHeap<T>::NODE_ELT);
 		nb_nodes=0;
 	}
@@ -230,58 +266,94 @@ void DoubleHeap<T>::contract(double new_loup1) {
 
 	if (nb_nodes==0) return;
 
-	SharedHeap<T>* copy1 = new SharedHeap<T>(heap1->costf, heap1->update_cost_when_sorting, 0);
-
-	contract_rec(new_loup1, heap1->root, *copy1, !heap2->update_cost_when_sorting);
-
-	heap1->root = copy1->root;
-	heap1->nb_nodes = copy1->size();
-	nb_nodes = copy1->size();
-	copy1->root = NULL;
-	copy1->nb_nodes=0;// avoid to delete heap1 with copy1
-	delete copy1;
+	// the cost are assumed to be up-to-date for the 1st heap.
+
+	// Remove the data one by one, unless too many of
+	// them have to be removed (see remove_all_sup).
+	unsigned int max_removed = nb_nodes/bulk_ratio + 1;
+
+	while (nb_nodes>0 && heap_max1->l[0]->is_sup(new_loup1, 0)) {
+		if (max_removed-- == 0) {
+			remove_all_sup(new_loup1);
+			break;
+		}
+		HeapElt<T>* elt = heap_max1->pop_elt();
+		heap1->erase_elt(elt);
+		heap2->erase_elt(elt);
+		if (elt->data) delete elt->data;
+		delete elt;
+		nb_nodes--;
+	}
 
-	if (heap2->update_cost_when_sorting) heap2->sort();
+	// The costs of the second heap may depend on loup1: the
+	// heap is sorted later (see update2)
+	if (heap2->update_cost_when_sorting)
+		sort2_pending=true;
 
 	assert(nb_nodes==heap2->size());
 	assert(nb_nodes==heap1->size());
+	assert(nb_nodes==heap_max1->size());
 	assert(heap1->heap_state());
-	assert(!heap2 || heap2->heap_state());
+	assert(heap_max1->heap_state());
+	assert(sort2_pending || heap2->heap_state());
 }
 
+template<class T>
+void DoubleHeap<T>::remove_all_sup(double loup1) {
+	// The removed elements are marked by an index in the first
+	// heap equal to nb_nodes (out of range).
+	std::vector<HeapElt<T>*>& l1=heap1->l;
+	unsigned int k=0;
+	for (unsigned int i=0; i<l1.size(); i++) {
+		if (l1[i]->is_sup(loup1, 0))
+			l1[i]->index[0] = nb_nodes;
+		else
+			l1[k++] = l1[i];
+	}
+	l1.resize(k);
+
+	std::vector<HeapElt<T>*>& lmax=heap_max1->l;
+	k=0;
+	for (unsigned int i=0; i<lmax.size(); i++) {
+		if (lmax[i]->index[0]!=nb_nodes)
+			lmax[k++] = lmax[i];
+	}
+	lmax.resize(k);
+
+	std::vector<HeapElt<T>*>& l2=heap2->l;
+	k=0;
+	for (unsigned int i=0; i<l2.size(); i++) {
+		if (l2[i]->index[0]==nb_nodes) {
+			if (l2[i]->data) delete l2[i]->data;
+			delete l2[i];
+		} else
+			l2[k++] = l2[i];
+	}
+	l2.resize(k);
+
+	nb_nodes = k;
+
+	heap1->heapify();
+	heap_max1->heapify();
+	heap2->heapify();
+}
 
 template<class T>
-void DoubleHeap<T>::contract_rec(double new_loup1, HeapNode<T>* node, SharedHeap<T>& heap, bool percolate) {
+void DoubleHeap<T>::sort1() {
+	heap1->sort();
 
-	// the cost are assumed to be up-to-date for the 1st heap
-	if (node->is_sup(new_loup1, 0)) {
-		// we must remove from the other heap all the sub-nodes
-		if (heap2) erase_subnodes(node, percolate);
-	} else {
-		heap.push_elt(node->elt);
-		if (node->left)	 contract_rec(new_loup1, node->left, heap, percolate);
-		if (node->right) contract_rec(new_loup1, node->right, heap, percolate);
+	for (typename std::vector<HeapElt<T>*>::iterator it=heap_max1->l.begin(); it!=heap_max1->l.end(); it++)
+		(*it)->crit[2] = -(*it)->crit[0];
 
-		delete node;
-	}
+	heap_max1->heapify();
 }
 
 template<class T>
-void DoubleHeap<T>::erase_subnodes(HeapNode<T>* node, bool percolate) {
-	if (node->left)	erase_subnodes(node->left, percolate);
-	if (node->right) erase_subnodes(node->right, percolate);
-
-	if (!percolate)
-		// there is no need to update the order now in the second heap
-		// since all costs will have to be recalculated.
-		// The heap2 will be sorted at the end (see contract)
-		heap2->erase_node_no_percolate(node->elt->holder[1]);
-	else
-		heap2->erase_node(node->elt->holder[1]);
-
-	if (node->elt->data) delete node->elt->data;
-	delete node->elt;
-	delete node;
+void DoubleHeap<T>::update2() const {
+	if (sort2_pending) {
+		heap2->sort();
+		sort2_pending=false;
+	}
 }
 
 template<class T>
@@ -301,6 +373,7 @@ void DoubleHeap<T>::push(T* data) {
 
 	// the data is put into the first heap
 	heap1->push_elt(elt);
+	heap_max1->push_elt(elt);
 	if (heap2) heap2->push_elt(elt);
 
 	nb_nodes++;
@@ -316,11 +389,13 @@ T* DoubleHeap<T>::pop() {
 	HeapElt<T>* elt;
 	if (current_heap_id==0) {
 		elt = heap1->pop_elt();
-		if (heap2) heap2->erase_node(elt->holder[1]);
+		if (heap2) heap2->erase_elt(elt);
 	} else {
+		update2();
 		elt = heap2->pop_elt();
-		heap1->erase_node(elt->holder[0]);
+		heap1->erase_elt(elt);
 	}
+	heap_max1->erase_elt(elt);
 	T* data = elt->data;
 	elt->data=NULL; // avoid the data to be deleted with the element
 	delete elt;
@@ -328,7 +403,8 @@ T* DoubleHeap<T>::pop() {
 	nb_nodes--;
 
 	assert(heap1->heap_state());
-	assert(!heap2 || heap2->heap_state());
+	assert(heap_max1->heap_state());
+	assert(!heap2 || sort2_pending || heap2->heap_state());
 
 	// select the heap
 	if (RNG::rand() % 100 >= static_cast<unsigned>(critpr)) {
@@ -365,6 +441,7 @@ T* DoubleHeap<T>::top() const {
 	}
 	else {
 		// the second heap is used
+		update2();
 		return heap2->top();
 	}
 }
@@ -380,6 +457,7 @@ template<class T>
 T* DoubleHeap<T>::top2() const {
 	// the second heap is used
 	current_heap_id=1;
+	update2();
 	return heap2->top();
 
 }
@@ -391,7 +469,7 @@ template<class T>
 inline double DoubleHeap<T>::minimum1() const { return heap1->minimum(); }
 
 template<class T>
-inline double DoubleHeap<T>::minimum2() const { return heap2->minimum(); }
+inline double DoubleHeap<T>::minimum2() const { update2(); return heap2->minimum(); }
 
 template<class T>
 std::ostream& DoubleHeap<T>::print(std::ostream& os) const{
@@ -400,10 +478,11 @@ std::ostream& DoubleHeap<T>::print(std::ostream& os) const{
 		os<<std::endl;
 	} else {
 		os << "First Heap:  "<<std::endl;
-		heap1->print(os);
+		os << *heap1;
 		os<<std::endl;
 		os << "Second Heap: "<<std::endl;
-		heap2->print(os);
+		update2();
+		os << *heap2;
 		os<<std::endl;
 	}
 	return os;
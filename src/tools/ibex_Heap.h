@@ -15,6 +15,7 @@
 #include <vector>
 #include <algorithm>
 #include <iostream>
+#include <limits>
 
 namespace ibex {
 
@@ -95,6 +96,9 @@ public:
 	 *
 	 * Removes (and deletes) from the heap all the elements
 	 * with a cost greater than \a lb.
+	 *
+	 * Complexity: O(size), or O(1) if no element can have
+	 * a cost greater than \a lb.
 	 */
 	void contract(double lb);
 
@@ -115,6 +119,9 @@ protected:
 	// elements and associated "costs"
 	std::vector<std::pair<T*,double> > l;
 
+	// upper bound of the costs in the heap
+	double max_cost;
+
 	template<class U>
 	friend std::ostream& operator<<(std::ostream&, const Heap<U>&);
 };
@@ -139,12 +146,12 @@ struct HeapComparator {
 };
 
 template<class T>
-Heap<T>::Heap(CostFunc<T>& costf) : costf(costf) {
+Heap<T>::Heap(CostFunc<T>& costf) : costf(costf), max_cost(-std::numeric_limits<double>::infinity()) {
 
 }
 
 template<class T>
-Heap<T>::Heap(const Heap& heap) : costf(heap.costf) {
+Heap<T>::Heap(const Heap& heap) : costf(heap.costf), max_cost(heap.max_cost) {
 	for(typename std::vector<std::pair<T*,double> >::const_iterator it=heap.l.begin(); it!=heap.l.end(); it++) {
 		l.push_back(make_pair(new T(*(it->first)), it->second));
 	}
@@ -161,6 +168,7 @@ void Heap<T>::flush() {
 		delete it->first;
 
 	l.clear();
+	max_cost=-std::numeric_limits<double>::infinity();
 }
 
 template<class T>
@@ -175,19 +183,27 @@ template<class T>
 void Heap<T>::contract(double loup) {
 	//cout << " before contract heap  " << l.size() << endl;
 
-	sort_heap(l.begin(),l.end(),HeapComparator<T>());
-	typename std::vector<std::pair<T*,double> >::iterator it0=l.begin();
-
-	int k=0;
-	while (it0!=l.end() && it0->second > loup) { it0++; k++; }
-
-	for (int i=0;i<k;i++) {
-		delete l[i].first;
+	// nothing to remove
+	if (max_cost <= loup) return;
+
+	// remove the elements in place and rebuild
+	// the heap (linear time)
+	typename std::vector<std::pair<T*,double> >::iterator it1=l.begin();
+	max_cost=-std::numeric_limits<double>::infinity();
+
+	for (typename std::vector<std::pair<T*,double> >::iterator it0=l.begin(); it0!=l.end(); it0++) {
+		if (it0->second > loup)
+			delete it0->first;
+		else {
+			if (it0->second > max_cost) max_cost=it0->second;
+			*(it1++)=*it0;
+		}
 	}
 
-	if (k>0) l.erase(l.begin(),it0);
-
-	make_heap(l.begin(), l.end() ,HeapComparator<T>());
+	if (it1!=l.end()) {
+		l.erase(it1,l.end());
+		make_heap(l.begin(), l.end() ,HeapComparator<T>());
+	}
 
 	//cout << " after contract heap " << l.size() << endl;
 
@@ -200,7 +216,9 @@ bool Heap<T>::empty() const {
 
 template<class T>
 void Heap<T>::push(T* el) {
-	l.push_back(std::pair<T*,double>(el,cost(*el)));
+	double c=cost(*el);
+	if (c > max_cost) max_cost=c;
+	l.push_back(std::pair<T*,double>(el,c));
 	push_heap(l.begin(), l.end(), HeapComparator<T>());
 }
 
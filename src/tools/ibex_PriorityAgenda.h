@@ -0,0 +1,216 @@
+/* ============================================================================
+ * I B E X - Propagation Agenda with priorities
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_PRIORITY_AGENDA_H__
+#define __IBEX_PRIORITY_AGENDA_H__
+
+#include "ibex_Agenda.h"
+
+#include <cassert>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Agenda with priorities.
+ *
+ * A fixed-size set of integers in [0,size-1], each associated to a
+ * priority. The "pop" operation retrieves the element with the highest
+ * priority (ties are broken by order of insertion, so that with equal
+ * priorities, the agenda behaves as the FIFO #ibex::Agenda).
+ *
+ * Pushing an element already present raises its priority to the
+ * maximum of the two values.
+ *
+ * Implemented as an indexed binary heap: push and pop are O(log size).
+ */
+class PriorityAgenda {
+public:
+
+	/**
+	 * \brief Create the agenda.
+	 *
+	 * All elements will be inside the range [0,size-1].
+	 */
+	PriorityAgenda(int size);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PriorityAgenda();
+
+	/**
+	 * \brief Push an integer with a priority.
+	 *
+	 * If \a p is already present, its priority becomes the
+	 * maximum of the current one and \a priority.
+	 */
+	void push(int p, double priority);
+
+	/**
+	 * \brief Pop the integer with the highest priority.
+	 *
+	 * \throw EmptyAgendaException if the agenda is empty.
+	 */
+	void pop(int& p);
+
+	/**
+	 * \brief True iff \a p is in the agenda.
+	 */
+	bool contains(int p) const;
+
+	/**
+	 * \brief Current priority of \a p.
+	 *
+	 * \pre \a p is in the agenda.
+	 */
+	double priority(int p) const;
+
+	/**
+	 * \brief True iff the agenda is empty.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Number of elements in the agenda.
+	 */
+	int nb_elements() const;
+
+	/**
+	 * \brief Remove all elements.
+	 */
+	void flush();
+
+	/**
+	 * \brief Size of the agenda.
+	 */
+	const int size;
+
+private:
+	PriorityAgenda(const PriorityAgenda&);
+
+	// true iff heap[i] must be popped before heap[j]
+	bool before(int i, int j) const;
+	void swap(int i, int j);
+	void sift_up(int i);
+	void sift_down(int i);
+
+	int* heap;      // heap[0..n-1]: the elements
+	int* pos;       // pos[p]: position of p in heap (-1 if absent)
+	double* prio;   // prio[p]: priority of p
+	long* stamp;    // stamp[p]: insertion order of p
+	int n;          // number of elements
+	long counter;   // number of insertions so far
+};
+
+/*================================== inline implementations ========================================*/
+
+inline PriorityAgenda::PriorityAgenda(int size) : size(size), n(0), counter(0) {
+	heap = new int[size];
+	pos = new int[size];
+	prio = new double[size];
+	stamp = new long[size];
+	for (int i=0; i<size; i++) pos[i]=-1;
+}
+
+inline PriorityAgenda::~PriorityAgenda() {
+	delete[] heap;
+	delete[] pos;
+	delete[] prio;
+	delete[] stamp;
+}
+
+inline bool PriorityAgenda::before(int i, int j) const {
+	int a=heap[i];
+	int b=heap[j];
+	return prio[a]>prio[b] || (prio[a]==prio[b] && stamp[a]<stamp[b]);
+}
+
+inline void PriorityAgenda::swap(int i, int j) {
+	int tmp=heap[i];
+	heap[i]=heap[j];
+	heap[j]=tmp;
+	pos[heap[i]]=i;
+	pos[heap[j]]=j;
+}
+
+inline void PriorityAgenda::sift_up(int i) {
+	while (i>0 && before(i,(i-1)/2)) {
+		swap(i,(i-1)/2);
+		i=(i-1)/2;
+	}
+}
+
+inline void PriorityAgenda::sift_down(int i) {
+	for (;;) {
+		int best=i;
+		int l=2*i+1;
+		int r=l+1;
+		if (l<n && before(l,best)) best=l;
+		if (r<n && before(r,best)) best=r;
+		if (best==i) return;
+		swap(i,best);
+		i=best;
+	}
+}
+
+inline void PriorityAgenda::push(int p, double priority) {
+	assert(p>=0 && p<size);
+	if (pos[p]!=-1) {
+		if (priority>prio[p]) {
+			prio[p]=priority;
+			sift_up(pos[p]);
+		}
+		return;
+	}
+	prio[p]=priority;
+	stamp[p]=counter++;
+	heap[n]=p;
+	pos[p]=n;
+	n++;
+	sift_up(n-1);
+}
+
+inline void PriorityAgenda::pop(int& p) {
+	if (n==0) throw EmptyAgendaException();
+	p=heap[0];
+	n--;
+	if (n>0) {
+		heap[0]=heap[n];
+		pos[heap[0]]=0;
+		sift_down(0);
+	}
+	pos[p]=-1;
+}
+
+inline bool PriorityAgenda::contains(int p) const {
+	return pos[p]!=-1;
+}
+
+inline double PriorityAgenda::priority(int p) const {
+	assert(contains(p));
+	return prio[p];
+}
+
+inline bool PriorityAgenda::empty() const {
+	return n==0;
+}
+
+inline int PriorityAgenda::nb_elements() const {
+	return n;
+}
+
+inline void PriorityAgenda::flush() {
+	for (int i=0; i<n; i++) pos[heap[i]]=-1;
+	n=0;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_PRIORITY_AGENDA_H__
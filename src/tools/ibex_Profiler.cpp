@@ -0,0 +1,158 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Profiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+//============================================================================
+
+#include "ibex_Profiler.h"
+#include "ibex_Exception.h"
+
+#include <chrono>
+#include <fstream>
+#include <cmath>
+#include <cstdlib>
+#include <cassert>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+Profiler::Profiler() {
+
+}
+
+Profiler::~Profiler() {
+	clear();
+}
+
+Profiler::Entry& Profiler::entry(const string& name) {
+	lock_guard<mutex> lock(mtx);
+
+	for (vector<Entry*>::iterator it=_entries.begin(); it!=_entries.end(); ++it)
+		if ((*it)->name==name) return **it;
+
+	_entries.push_back(new Entry(name));
+	return *_entries.back();
+}
+
+void Profiler::add(Entry& e, double time) {
+	lock_guard<mutex> lock(mtx);
+	e.calls++;
+	e.time+=time;
+}
+
+void Profiler::add(Entry& e, double time, const IntervalVector& before, const IntervalVector& after) {
+	if (after.is_empty()) {
+		add_empty(e, time);
+		return;
+	}
+
+	double r=volume_ratio(before, after);
+
+	lock_guard<mutex> lock(mtx);
+	e.calls++;
+	e.time+=time;
+	e.ratio_sum+=r;
+	e.nb_ratios++;
+}
+
+void Profiler::add_empty(Entry& e, double time) {
+	lock_guard<mutex> lock(mtx);
+	e.calls++;
+	e.time+=time;
+	e.empty++;
+}
+
+void Profiler::clear() {
+	lock_guard<mutex> lock(mtx);
+	for (vector<Entry*>::iterator it=_entries.begin(); it!=_entries.end(); ++it)
+		delete *it;
+	_entries.clear();
+}
+
+void Profiler::write_csv(ostream& os) const {
+	lock_guard<mutex> lock(mtx);
+	os << "name,calls,time,time_per_call,volume_ratio,empty_rate" << endl;
+	for (vector<Entry*>::const_iterator it=_entries.begin(); it!=_entries.end(); ++it) {
+		const Entry& e=**it;
+		os << '"' << e.name << "\"," << e.calls << ',' << e.time << ','
+		   << (e.calls==0 ? 0.0 : e.time/e.calls) << ','
+		   << e.volume_ratio() << ',' << e.empty_rate() << endl;
+	}
+}
+
+void Profiler::write_json(ostream& os) const {
+	lock_guard<mutex> lock(mtx);
+	os << "[" << endl;
+	for (vector<Entry*>::const_iterator it=_entries.begin(); it!=_entries.end(); ++it) {
+		const Entry& e=**it;
+		if (it!=_entries.begin()) os << "," << endl;
+		os << "  { \"name\": \"" << e.name << "\", \"calls\": " << e.calls
+		   << ", \"time\": " << e.time
+		   << ", \"time_per_call\": " << (e.calls==0 ? 0.0 : e.time/e.calls)
+		   << ", \"volume_ratio\": " << e.volume_ratio()
+		   << ", \"empty_rate\": " << e.empty_rate() << " }";
+	}
+	os << endl << "]" << endl;
+}
+
+void Profiler::save(const char* filename) const {
+	ofstream f(filename);
+	if (!f.is_open())
+		ibex_error("[Profiler] cannot open output file");
+
+	string s(filename);
+	if (s.size()>=5 && s.compare(s.size()-5, 5, ".json")==0)
+		write_json(f);
+	else
+		write_csv(f);
+}
+
+double Profiler::now() {
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double Profiler::volume_ratio(const IntervalVector& before, const IntervalVector& after) {
+	assert(before.size()==after.size());
+
+	if (after.is_empty()) return 0;
+
+	double log_ratio=0;
+
+	for (int i=0; i<before.size(); i++) {
+		double d=before[i].diam();
+		if (d>0 && d<POS_INFINITY) {
+			double d2=after[i].diam();
+			if (d2==0) return 0;
+			log_ratio+=::log(d2)-::log(d);
+		}
+	}
+
+	return ::exp(log_ratio);
+}
+
+string Profiler::type_name(const type_info& t) {
+	string name;
+#ifdef __GNUG__
+	int status;
+	char* s=abi::__cxa_demangle(t.name(), NULL, NULL, &status);
+	if (status==0 && s) {
+		name=s;
+		free(s);
+	} else
+		name=t.name();
+#else
+	name=t.name(); // e.g., "class ibex::CtcHC4" with MSVC
+	if (name.compare(0,6,"class ")==0) name=name.substr(6);
+#endif
+	if (name.compare(0,6,"ibex::")==0) name=name.substr(6);
+	return name;
+}
+
+} // end namespace ibex
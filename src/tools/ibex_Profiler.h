@@ -0,0 +1,201 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Profiler.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_PROFILER_H__
+#define __IBEX_PROFILER_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <typeinfo>
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Statistics on the operators of a search (contractors,
+ * bisector, loup finder).
+ *
+ * A profiler is opt-in: it is only fed by the strategies it is
+ * given to (see Solver::profiler and Optimizer::profiler) and by the
+ * contractors wrapped with #ibex::CtcProfiler.
+ *
+ * For each operator (identified by a name), the profiler records the
+ * number of calls, the total wall-clock time, the average ratio
+ * between the volume of the box after and before the call, and the
+ * number of calls that resulted in an empty box.
+ *
+ * Entries can be fed concurrently by several threads.
+ */
+class Profiler {
+public:
+
+	/**
+	 * \brief Statistics of one operator.
+	 */
+	class Entry {
+	public:
+		/**
+		 * \brief Create an entry with no call.
+		 */
+		explicit Entry(const std::string& name);
+
+		/**
+		 * \brief Name of the operator.
+		 */
+		const std::string name;
+
+		/**
+		 * \brief Number of calls.
+		 */
+		unsigned long calls;
+
+		/**
+		 * \brief Total wall-clock time (in seconds).
+		 */
+		double time;
+
+		/**
+		 * \brief Number of calls that resulted in an empty box.
+		 */
+		unsigned long empty;
+
+		/**
+		 * \brief Sum of the volume ratios (after/before) of the
+		 * calls where the box was measured and not emptied.
+		 */
+		double ratio_sum;
+
+		/**
+		 * \brief Number of terms in ratio_sum.
+		 */
+		unsigned long nb_ratios;
+
+		/**
+		 * \brief Average volume ratio (1 if no call was measured).
+		 */
+		double volume_ratio() const;
+
+		/**
+		 * \brief Proportion of calls that resulted in an empty box.
+		 */
+		double empty_rate() const;
+	};
+
+	/**
+	 * \brief Create an empty profiler.
+	 */
+	Profiler();
+
+	/**
+	 * \brief Delete this.
+	 */
+	~Profiler();
+
+	/**
+	 * \brief The entry of an operator (created if necessary).
+	 *
+	 * The reference remains valid until the profiler is cleared or
+	 * deleted.
+	 */
+	Entry& entry(const std::string& name);
+
+	/**
+	 * \brief Record a call (timing only).
+	 */
+	void add(Entry& e, double time);
+
+	/**
+	 * \brief Record a call that has transformed the box
+	 * \a before into \a after.
+	 */
+	void add(Entry& e, double time, const IntervalVector& before, const IntervalVector& after);
+
+	/**
+	 * \brief Record a call that resulted in an empty box.
+	 */
+	void add_empty(Entry& e, double time);
+
+	/**
+	 * \brief All the entries, in order of creation.
+	 */
+	const std::vector<Entry*>& entries() const;
+
+	/**
+	 * \brief Remove all the entries.
+	 */
+	void clear();
+
+	/**
+	 * \brief Write the statistics in CSV format (one line per entry).
+	 */
+	void write_csv(std::ostream& os) const;
+
+	/**
+	 * \brief Write the statistics in JSON format.
+	 */
+	void write_json(std::ostream& os) const;
+
+	/**
+	 * \brief Write the statistics into a file.
+	 *
+	 * The format is JSON if the file name ends with ".json",
+	 * CSV otherwise.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Current wall-clock time (in seconds, from an arbitrary origin).
+	 */
+	static double now();
+
+	/**
+	 * \brief Volume of \a after divided by the volume of \a before.
+	 *
+	 * Only the components of \a before with a finite and positive
+	 * diameter are taken into account (1 if there is none).
+	 * The calculation is done in log scale, to avoid overflows.
+	 */
+	static double volume_ratio(const IntervalVector& before, const IntervalVector& after);
+
+	/**
+	 * \brief Readable name of a class (e.g., "CtcHC4").
+	 */
+	static std::string type_name(const std::type_info& t);
+
+private:
+	std::vector<Entry*> _entries;
+
+	mutable std::mutex mtx;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline Profiler::Entry::Entry(const std::string& name) : name(name), calls(0), time(0), empty(0), ratio_sum(0), nb_ratios(0) {
+
+}
+
+inline double Profiler::Entry::volume_ratio() const {
+	return nb_ratios==0 ? 1.0 : ratio_sum/nb_ratios;
+}
+
+inline double Profiler::Entry::empty_rate() const {
+	return calls==0 ? 0.0 : ((double) empty)/calls;
+}
+
+inline const std::vector<Profiler::Entry*>& Profiler::entries() const {
+	return _entries;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_PROFILER_H__
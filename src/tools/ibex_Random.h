@@ -90,7 +90,8 @@ namespace ibex {
 
 	private:
 		static const uint32_t x0,y0,z0;
-		static uint32_t x,y,z,seed;
+		// one generator per thread (see parallel mode of Solver)
+		static thread_local uint32_t x,y,z,seed;
 	};
 }
 
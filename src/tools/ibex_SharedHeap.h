@@ -14,11 +14,11 @@
 #include <iostream>
 #include <cassert>
 #include <stack>
+#include <vector>
 #include "ibex_Heap.h" // just for the declaration of CostFunc<T>
 
 namespace ibex {
 
-template<class T> class HeapNode;
 template<class T> class HeapElt;
 template<class T> class DoubleHeap;
 
@@ -42,6 +42,12 @@ template<class T> class DoubleHeap;
  *       the element with the minimal "cost" (criterion).</li>
  *  <li> #push() is also in logarithmic time.</li>
  *  </ul>
+ *
+ * The heap is an implicit binary tree stored in an array: the sons
+ * of the ith element are the (2i+1)th and (2i+2)th elements.
+ * Each element stores its position in the array (for each heap it
+ * belongs to), so that it can be removed from any heap in
+ * logarithmic time.
  */
 template<class T>
 class SharedHeap  {
@@ -57,7 +63,12 @@ public:
 	 */
 	SharedHeap(CostFunc<T>& cost, bool update_cost_when_sorting, int id);
 
-	/** Constructor by copy */
+	/**
+	 * \brief Constructor by copy
+	 *
+	 * The elements are duplicated (with positions in the other heaps
+	 * left undefined) and are in the same order as in \a heap.
+	 */
 	SharedHeap(const SharedHeap<T>& heap, int nb_crit, bool deep_copy);
 
 	/** \brief Delete this.
@@ -76,9 +87,9 @@ public:
 	/**
 	 * \brief Clear the heap.
 	 *
-	 * NODE:          only nodes are deleted
-	 * NODE_ELT:      nodes and elements are deleted
-	 * NODE_ELT_DATA: nodes, elements and data are deleted
+	 * NODE:          only the heap structure is cleared
+	 * NODE_ELT:      elements are also deleted
+	 * NODE_ELT_DATA: elements and data are also deleted
 	 */
 	void clear(clear_mode mode=NODE_ELT_DATA);
 
@@ -96,18 +107,13 @@ public:
 	double minimum() const;
 
 	/**
-	 * \brief update the cost and sort all the heap
-	 * complexity: o(nb_nodes*log(nb_nodes))
+	 * \brief Update the costs (if update_cost_when_sorting
+	 *        is true) and sort all the heap
 	 *
-	 * \param update_cost: if true, costs are all recalculated
+	 * Complexity: o(nb_nodes)
 	 */
 	void sort();
 
-	/**
-	 * \brief Count the number of nodes pushed since
-	 *         the object is created. */
-	unsigned int nb_nodes;
-
 	/**
 	 * \brief Cost function associated to this heap
 	 */
@@ -123,12 +129,12 @@ protected:
 	/** The "cost" of an element. */
 	double cost(const T& data) const;
 
-	/** The root of the heap */
-	HeapNode<T>* root;
-
 	/** Whether the cost function is called again inside sort. */
 	bool update_cost_when_sorting;
 
+	/** The elements (l[0] is the root). */
+	std::vector<HeapElt<T>*> l;
+
 	/**
 	 * Pop an element and return it.
 	 *
@@ -144,41 +150,28 @@ protected:
 	void push_elt(HeapElt<T>* elt);
 
 	/**
-	 * Percolate (or "heapify") from the node \var node downto the bottom.
+	 * Percolate (or "heapify") from the ith element downto the bottom.
 	 */
-	void percolate_down(HeapNode<T>* node);
+	void percolate_down(unsigned int i);
 
 	/**
-	 * Percolate (or "heapify") from the node \var node upto the root.
+	 * Percolate (or "heapify") from the ith element upto the root.
 	 */
-	void percolate_up(HeapNode<T>* node);
+	void percolate_up(unsigned int i);
 
 	/**
-	 * \brief Remove a node and update the heap in consequence.
+	 * \brief Remove an element and update the heap in consequence.
 	 *
 	 * (call percolate_down and percolate_up).
 	 */
-	void erase_node(HeapNode<T>* node);
+	void erase_elt(HeapElt<T>* elt);
 
 	/**
-	 * \brief Remove a node.
-	 *
-	 * The last node is actually removed and its element is put in place
-	 * of the node element, except if the node is the last.
+	 * \brief Rebuild the heap from the elements in any order.
 	 *
-	 * The heap is not updated after (the new node is not at its right place
-	 * anymore and the heap is in undefined state).
-	 *
-	 * Complexity: O(1)
-	 */
-	HeapNode<T>* erase_node_no_percolate(HeapNode<T>* node);
-
-	/**
-	 * \brief Access to the ith node, rank by largest-first order.
-	 *
-	 * \param i - the node number
+	 * Complexity: O(nb_nodes)
 	 */
-	HeapNode<T>* get_node(unsigned int i) const;
+	void heapify();
 
 	/**
 	 * \brief Streams out the heap
@@ -198,68 +191,17 @@ protected:
 
 private:
 
-	/** Used in the sort function (proceed by recursivity) */
-	void sort_rec(HeapNode<T>* node, SharedHeap<T>& heap);
+	/** True iff the ith element has a greater cost than the jth. */
+	bool is_sup(unsigned int i, unsigned int j) const;
 
-	void elt_rec(HeapNode<T>* cur, std::vector<HeapElt<T>*>& elm_vect);
+	/** Put \a elt at the ith position. */
+	void set(unsigned int i, HeapElt<T>* elt);
 
-	void clear_subnodes(HeapNode<T>* node, clear_mode mode);
+	/** Switch the ith and jth elements. */
+	void switch_elt(unsigned int i, unsigned int j);
 };
 
 
-
-/**
- * \ingroup strategy
- *
- * \brief Shared heap node (internal)
- *
- * Class to be used by DoubleHeap only.
- */
-template<class T>
-class HeapNode {
-
-private:
-	friend class SharedHeap<T>;
-	friend class DoubleHeap<T>;
-
-	/** Create a node from an element and the father node. */
-	explicit HeapNode(HeapElt<T>* elt, int heap_id, HeapNode<T>* father);
-
-	/** Constructor by copy. */
-	explicit HeapNode(const HeapNode& node, HeapNode<T>* father, int heap_id, int nb_crit, bool deep_copy);
-
-	/** Delete the node and all its sons */
-	//~HeapNode() ;
-
-	/** the stored element. */
-	HeapElt<T>* elt;
-
-	/** Right sub-node */
-	HeapNode<T>* right;
-
-	/** Left sub-node */
-	HeapNode<T>* left;
-
-	/** Father node. */
-	HeapNode<T>* father;
-
-	/** Compare the heap_id-cost of this node to "node". */
-	bool is_sup(HeapNode<T>* node, int heap_id) const;
-
-	/** Compare the heap_id-cost of this node to the value "d". */
-	bool is_sup(double d, int heap_id) const;
-
-	/** Switch the elements between *this and node */
-	void switch_elt(HeapNode<T>* node, int heap_id);
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const HeapNode<U>& node);
-
-	template<class U>
-	friend std::ostream& operator<<(std::ostream& os, const SharedHeap<U>& heap);
-
-};
-
 /**
  * \ingroup strategy
  *
@@ -271,25 +213,18 @@ template<class T>
 class HeapElt {
 
 private:
-	friend class HeapNode<T>;
 	friend class SharedHeap<T>;
 	friend class DoubleHeap<T>;
 
-	/** Create an CellHeapElt with a data and its criteria */
-	//CellHeapElt(int nb_crit, T* elt, double *crit);
-
 	/** Create an HeapElt with a data and one criterion */
 	explicit HeapElt(T* data, double crit_1);
 
 	/** Create an HeapElt with a data and two criteria */
 	explicit HeapElt(T* data, double crit_1, double crit_2);
 
-    /** Copy constructor (not holders) **/
+    /** Copy constructor (not positions) **/
 	explicit HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep_copy);
 
-	/** Delete the element (*not the data*) */
-	~HeapElt() ;
-
 	/**
 	 * Compare the criterion of a given heap with the value d.
 	 * Return true if the criterion is greater.
@@ -299,15 +234,14 @@ private:
 	/** the stored data. */
 	T* data;
 
-//	/** The number of different heaps this element belongs to */
-//	int nb_heaps;
-
 	/** the criteria of the stored data (one for each heap this
-	 * element belongs to). */
-	double *crit;
+	 * element belongs to). The last one is the opposite of the
+	 * first one (used by DoubleHeap to find the elements with
+	 * the largest first criterion). */
+	double crit[3];
 
-	/** The node that holds this element, for each heap. */
-	HeapNode<T>** holder;
+	/** The position of this element, for each heap. */
+	unsigned int index[3];
 
 	template<class U>
 	friend std::ostream& operator<<(std::ostream& os, const HeapElt<U>& node) ;
@@ -322,31 +256,23 @@ private:
 
 
 template<class T>
-SharedHeap<T>::SharedHeap(CostFunc<T>& cost, bool update_cost, int id) : nb_nodes(0), costf(cost), heap_id(id), root(NULL), update_cost_when_sorting(update_cost) {
+SharedHeap<T>::SharedHeap(CostFunc<T>& cost, bool update_cost, int id) : costf(cost), heap_id(id), update_cost_when_sorting(update_cost) {
 
 }
 
 template<class T>
 SharedHeap<T>::SharedHeap(const SharedHeap<T>& heap, int nb_crit, bool deep_copy) :
- nb_nodes(heap.nb_nodes), costf(heap.costf), heap_id(heap.heap_id), root(NULL), update_cost_when_sorting(heap.update_cost_when_sorting) {
-	if (heap.root != NULL)
-		root = new HeapNode<T>(*(heap.root), NULL, heap_id, nb_crit, deep_copy);
+ costf(heap.costf), heap_id(heap.heap_id), update_cost_when_sorting(heap.update_cost_when_sorting) {
+	l.reserve(heap.l.size());
+	for (unsigned int i=0; i<heap.l.size(); i++) {
+		l.push_back(new HeapElt<T>(*(heap.l[i]), nb_crit, deep_copy));
+		l.back()->index[heap_id] = i;
+	}
 }
 
 template<class T>
 std::vector<HeapElt<T>*> SharedHeap<T>::elt() {
-    std::vector<HeapElt<T>*> elm_vect;
-    elt_rec(root, elm_vect);
-    return elm_vect;
-}
-
-template<class T>
-void SharedHeap<T>::elt_rec(HeapNode<T>* cur, std::vector<HeapElt<T>*> &elm_vect) {
-    if(cur != NULL) {
-    	elm_vect.push_back(cur->elt);
-        elt_rec(cur->right, elm_vect);
-        elt_rec(cur->left, elm_vect);
-    }
+    return l;
 }
 
 template<class T>
@@ -356,66 +282,43 @@ SharedHeap<T>::~SharedHeap() {
 
 template<class T>
 void SharedHeap<T>::clear(clear_mode mode) {
-	if (nb_nodes>0) {
-		clear_subnodes(root, mode);
-		nb_nodes=0;
-		root=NULL;
-	}
-}
-
-template<class T>
-void SharedHeap<T>::clear_subnodes(HeapNode<T>* node, clear_mode mode) {
-	if (node->left)	clear_subnodes(node->left, mode);
-	if (node->right) clear_subnodes(node->right, mode);
-
-	if (mode==NODE_ELT)
-		delete node->elt;
-	else if (mode==NODE_ELT_DATA) {
-		if (node->elt->data)
-			delete node->elt->data;
-		delete node->elt;
+	if (mode!=NODE) {
+		for (typename std::vector<HeapElt<T>*>::iterator it=l.begin(); it!=l.end(); it++) {
+			if (mode==NODE_ELT_DATA && (*it)->data)
+				delete (*it)->data;
+			delete *it;
+		}
 	}
-
-	delete node;
+	l.clear();
 }
 
 template<class T>
 inline double SharedHeap<T>::minimum() const {
-	return root->elt->crit[heap_id];
+	return l[0]->crit[heap_id];
 }
 
 template<class T>
 unsigned int SharedHeap<T>::size() const {
-	return nb_nodes;
+	return l.size();
 }
 
 template<class T>
 bool SharedHeap<T>::empty() const {
-	return (nb_nodes==0);
+	return l.empty();
 }
 
 template<class T>
 T* SharedHeap<T>::top() const {
-	return root->elt->data;
+	return l[0]->data;
 }
 
-
 template<class T>
 void SharedHeap<T>::sort() {
-	if (nb_nodes==0) return;
-
-	SharedHeap<T>* heap_tmp = new SharedHeap<T>(costf, update_cost_when_sorting, heap_id);
-
-	// recursive sort : o(n*log(n))
-	sort_rec(root, *heap_tmp);
-
-	root = heap_tmp->root;
-	nb_nodes = heap_tmp->size();
-
-	heap_tmp->root = NULL;
-	heap_tmp->nb_nodes=0;
-	delete heap_tmp; 	// warning: delete all sub-nodes
+	if (update_cost_when_sorting)
+		for (typename std::vector<HeapElt<T>*>::iterator it=l.begin(); it!=l.end(); it++)
+			(*it)->crit[heap_id] = cost(*((*it)->data));
 
+	heapify();
 }
 
 template<class T>
@@ -424,302 +327,139 @@ inline double SharedHeap<T>::cost(const T& data) const {
 }
 
 template<class T>
-void SharedHeap<T>::sort_rec(HeapNode<T>* node, SharedHeap<T>& heap) {
-
-	if (update_cost_when_sorting)
-		node->elt->crit[heap_id] = cost(*(node->elt->data));
-
-	heap.push_elt(node->elt);
-	if (node->left)	 sort_rec(node->left, heap);
-	if (node->right) sort_rec(node->right, heap);
+inline bool SharedHeap<T>::is_sup(unsigned int i, unsigned int j) const {
+	return l[i]->is_sup(l[j]->crit[heap_id],heap_id);
+}
 
-	delete node;
+template<class T>
+inline void SharedHeap<T>::set(unsigned int i, HeapElt<T>* elt) {
+	l[i] = elt;
+	elt->index[heap_id] = i;
 }
 
 template<class T>
-void SharedHeap<T>::push_elt(HeapElt<T>* elt) {
+inline void SharedHeap<T>::switch_elt(unsigned int i, unsigned int j) {
+	HeapElt<T>* elt_tmp = l[i];
+	set(i, l[j]);
+	set(j, elt_tmp);
+}
 
-	if (nb_nodes==0) {
-		root = new HeapNode<T>(elt,heap_id,NULL);
-		nb_nodes++;
-	} else {
-		nb_nodes++;
-		// calculate height
-		int height = 0;
-		int aux = nb_nodes;
-		while(aux>1) { aux /= 2; height++;	}
-
-		// pt = pointer on the current element
-		HeapNode<T> * pt = root;
-		for (int pos=height-1; pos>0; pos--) {
-			if ( nb_nodes & (1 << pos)) {  // test the "pos"th bit of the integer nb_nodes
-				pt = pt->right;
-			} else {
-				pt = pt->left;
-			}
-		}
-		HeapNode<T>* tmp= new HeapNode<T>(elt,heap_id,pt);
-		if (nb_nodes%2==0) { pt->left =tmp; }
-		else               { pt->right=tmp; }
+template<class T>
+void SharedHeap<T>::heapify() {
+	for (unsigned int i=0; i<l.size(); i++)
+		l[i]->index[heap_id] = i;
 
-		percolate_up(tmp);
-	}
+	for (unsigned int i=l.size()/2; i>0; i--)
+		percolate_down(i-1);
 }
 
 template<class T>
-HeapNode<T> * SharedHeap<T>::get_node(unsigned int i) const {
-	assert(i<nb_nodes);
-	assert(nb_nodes>0);
-
-	// GET THE LAST ELEMENT and delete the associated node
-	// calculate height
-	int height = 0;
-	unsigned int aux = i+1;
-	while(aux>1) { aux /= 2; height++; }
-	//std::cout << "height of "<<i<<"  = " << height <<std::endl;
-	// pt = pointer on the current element
-	HeapNode<T>* pt = root;
-	for (int pos=height-1; pos>=0; pos--) {
-		if ( (i+1) & (1 << pos)) {  // test the "pos"th bit of the integer nb_nodes
-			//std::cout << "Right ";
-			pt = pt->right;
-		} else {
-			//std::cout << "Left ";
-			pt = pt->left;
-		}
-	}
-	return pt;
+void SharedHeap<T>::push_elt(HeapElt<T>* elt) {
+	l.push_back(elt);
+	elt->index[heap_id] = l.size()-1;
+	percolate_up(l.size()-1);
 }
 
 template<class T>
 HeapElt<T>* SharedHeap<T>::pop_elt() {
-	assert(nb_nodes>0);
-	HeapElt<T>* c_return = root->elt;
-	erase_node(root);
+	assert(!l.empty());
+	HeapElt<T>* c_return = l[0];
+	erase_elt(c_return);
 	return c_return;
 }
 
-// erase a node and update the order
+// erase an element and update the order
 template<class T>
-void SharedHeap<T>::erase_node(HeapNode<T>* node) {
-	assert(node);
-	assert(nb_nodes>0);
+void SharedHeap<T>::erase_elt(HeapElt<T>* elt) {
+	assert(!l.empty());
 
-	if (erase_node_no_percolate(node)) {
-		percolate_down(node);
-		percolate_up(node);
-	}
-}
+	unsigned int i = elt->index[heap_id];
+	assert(l[i]==elt);
 
-// erase a node without updating the order
-template<class T>
-HeapNode<T>* SharedHeap<T>::erase_node_no_percolate(HeapNode<T>* node) {
-	assert(nb_nodes>0);
-
-	if (nb_nodes==1) {
-		assert(node==root);
-		root->elt=NULL;
-		delete root;
-		root = NULL;
-		node = NULL; // return NULL
-	} else {
-		// Get the last element and delete the associated node without destroying the HeapElt
-		HeapNode<T>* last = get_node(nb_nodes-1);
-
-		// elt points on the last node data, that we will put in place of the deleted node
-		HeapElt<T>* elt = last->elt;
-
-		if (nb_nodes%2==0)	{ last->father->left =NULL; }
-		else 				{ last->father->right=NULL; }
-
-		// to avoid the element to be deleted with the node pt
-		last->elt = NULL;
-
-		if (node!=last) { // if the node to be deleted is not the last
-			node->elt = elt;
-			node->elt->holder[heap_id] = node;
-		} else {
-			node = NULL; // return NULL
-		}
-		delete last;
+	// the last element is put in place of the erased one
+	HeapElt<T>* last = l.back();
+	l.pop_back();
+
+	if (i<l.size()) {
+		set(i, last);
+		percolate_down(i);
+		percolate_up(i);
 	}
-	nb_nodes--;
-	return node;
 }
 
 template<class T>
-void SharedHeap<T>::percolate_up(HeapNode<T>* node) {
-	assert(node);
-
-	while (node->father && node->father->is_sup(node,heap_id)) {
-		node->switch_elt(node->father,heap_id);
-		node = node->father;
+void SharedHeap<T>::percolate_up(unsigned int i) {
+	while (i>0 && is_sup((i-1)/2,i)) {
+		switch_elt(i,(i-1)/2);
+		i = (i-1)/2;
 	}
 }
 
 template<class T>
-void SharedHeap<T>::percolate_down(HeapNode<T>* node) {
-	assert(node);
+void SharedHeap<T>::percolate_down(unsigned int i) {
+	unsigned int n = l.size();
 
 	// PERMUTATION to maintain the order in the heap when going down
-	bool b=true;
-	while (b && (node->left)) {
-		if (node->right) {
-			if (node->is_sup(node->left,heap_id)) {
-				if (node->right->is_sup(node->left,heap_id)) {
-					// left is the smallest
-					node->switch_elt(node->left,heap_id);
-					node = node->left;  // next
-				} else {
-					// right is the smallest
-					node->switch_elt(node->right,heap_id);
-					node = node->right;  // next
-				}
-			} else {
-				if (node->is_sup(node->right,heap_id)) {
-					// right is the smallest
-					node->switch_elt(node->right,heap_id);
-					node = node->right;  // next
-				} else { // current node is the smallest among the 3: stop
-					b=false;
-				}
-			}
-		} else { // no more right child but there is a left child
-			if (node->is_sup(node->left,heap_id)) {
-				// left is the smallest
-				node->switch_elt(node->left,heap_id);
-				node = node->left;  // next
-			} else { // current node is the smallest among the 3: stop (and we must have reached the bottom of the heap)
-				b=false;
+	for (;;) {
+		unsigned int left = 2*i+1;
+		unsigned int right = left+1;
+		unsigned int next = i;
+
+		if (left>=n) break;
+
+		if (right<n) {
+			if (is_sup(i,left)) {
+				// left is the smallest unless right is smaller
+				next = is_sup(right,left) ? left : right;
+			} else if (is_sup(i,right)) {
+				// right is the smallest
+				next = right;
 			}
+		} else if (is_sup(i,left)) {
+			// no right child but left is the smallest
+			next = left;
 		}
-	}
-}
-
-template<class T>
-bool SharedHeap<T>::heap_state() {
 
-	if (empty()) return true;
+		if (next==i) break; // current node is the smallest among the 3: stop
 
-	std::stack<HeapNode<T>* > s;
-	s.push(root);
-	while (!s.empty()) {
-		HeapNode<T>* node=s.top();
-		s.pop();
-		if (node->right && (!node->left)) {
-			//std::cerr << "node with only right child" << std::endl;
-			return false;
-		}
-		if (node->left) {
-			if (node->is_sup(node->left,heap_id)) {
-				//std::cerr << "node elt:" << node->elt->crit[heap_id] << " node left:" <<  node->left->elt->crit[heap_id] << std::endl;
-				return false;
-			}
-			else s.push(node->left);
-		}
-		if (node->right) {
-			if (node->is_sup(node->right,heap_id)) {
-				//std::cerr << "node elt:" << node->elt->crit[heap_id] << " node left:" <<  node->right->elt->crit[heap_id] << std::endl;
-				return false;
-			}
-			else s.push(node->right);
-		}
+		switch_elt(i,next);
+		i = next;
 	}
-	return true;
-}
-
-template<class T>
-HeapNode<T>::HeapNode(HeapElt<T>* elt, int heap_id, HeapNode<T>* father): elt(elt), right(NULL), left(NULL), father(father) {
-	elt->holder[heap_id] = this;
 }
 
-
-
 template<class T>
-HeapNode<T>::HeapNode(const HeapNode& node, HeapNode<T>* father, int heap_id, int nb_crit, bool deep_copy) :
-	elt(new HeapElt<T>(*(node.elt), nb_crit, deep_copy)),
-	right(NULL), left(NULL), father(father) {
-
-	elt->holder[heap_id] = this;
-
-	if (node.right != NULL) {
-		right = new HeapNode(*(node.right), this, heap_id, nb_crit, deep_copy);
-	}
-	if (node.left != NULL) {
-		left = new HeapNode(*(node.left), this, heap_id, nb_crit, deep_copy);
+bool SharedHeap<T>::heap_state() {
+	for (unsigned int i=0; i<l.size(); i++) {
+		if (l[i]->index[heap_id]!=i) return false;
+		if (i>0 && is_sup((i-1)/2,i)) return false;
 	}
+	return true;
 }
 
-//template<class T>
-//HeapNode<T>::~HeapNode() {
-//	// warning: delete all sub-nodes
-//
-//	if (elt) {
-//		// Next loop will allow us to call the destructor
-//		// on other holders of the same element "elt"
-//		// They will not try to delete twice "elt".
-//		for (int i=0; i<elt->nb_heaps; i++) {
-//			if (elt->holder[i]!=this) // skip myself
-//				elt->holder[i]->elt=NULL;
-//		}
-//		delete elt;
-//	}
-//
-//	if (right) 	delete right;
-//	if (left)  	delete left;
-//}
-
-template<class T>
-bool HeapNode<T>::is_sup(HeapNode<T>* node, int heap_id) const {
-	return elt->is_sup(node->elt->crit[heap_id],heap_id);
-}
-
-template<class T>
-bool HeapNode<T>::is_sup(double d, int heap_id) const {
-	return elt->is_sup(d,heap_id);
-}
-
-template<class T>
-void HeapNode<T>::switch_elt(HeapNode<T>* node, int heap_id) {
-
-	elt->holder[heap_id] = node;
-	node->elt->holder[heap_id] = this;
-
-	HeapElt<T> * elt_tmp = elt;
-	elt = node->elt;
-	node->elt = elt_tmp;
-
-}
-
-//////////////////////////////////////////////////////////////////////////////////////
-/** create an node with a data and its criterion */
-//CellHeapElt::CellHeapElt(int nb_crit,T* data, double *crit_in) : data(data), crit(new double[nb_crit]), indice(new unsigned int[nb_crit]){
-//	for (int i=0;i<nb_crit;i++) {
-//		crit[i] = crit_in[i];
-//		indice[i] = 0;
-//	}
-//}
-
 template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1) : data(data), /*nb_heaps(1),*/ crit(new double[1]), holder(new HeapNode<T>*[1]){
+HeapElt<T>::HeapElt(T* data, double crit_1) : data(data) {
 	crit[0] = crit_1;
-	holder[0] = NULL;
+	crit[1] = 0;
+	crit[2] = -crit_1;
+	index[0] = index[1] = index[2] = 0;
 }
 
 template<class T>
-HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data), /*nb_heaps(2),*/ crit(new double[2]), holder(new HeapNode<T>*[2]){
+HeapElt<T>::HeapElt(T* data, double crit_1, double crit_2) : data(data) {
 	crit[0] = crit_1;
 	crit[1] = crit_2;
-	holder[0] = NULL;
-	holder[1] = NULL;
+	crit[2] = -crit_1;
+	index[0] = index[1] = index[2] = 0;
 }
 
 template<class T>
-HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL), crit(new double[nb_crit]), holder(new HeapNode<T>*[nb_crit]) {
-	for(int i=0; i<nb_crit; i++) {
-        crit[i] = elt.crit[i];
-        holder[i] = NULL;
+HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL) {
+	assert(nb_crit<=2);
+	for(int i=0; i<3; i++) {
+        crit[i] = i<nb_crit ? elt.crit[i] : 0;
+        index[i] = 0;
     }
+	crit[2] = -crit[0];
     if (deep) {
     	data = new T(*(elt.data));
     } else {
@@ -727,12 +467,6 @@ HeapElt<T>::HeapElt(const HeapElt<T>& elt, int nb_crit, bool deep) : data(NULL),
     }
 }
 
-template<class T>
-HeapElt<T>::~HeapElt() {
-	delete [] crit;
-	delete [] holder;
-}
-
 template<class T>
 bool HeapElt<T>::is_sup(double d, int ind_crit) const {
 	return (crit[ind_crit] > d);
@@ -744,27 +478,20 @@ std::ostream& operator<<(std::ostream& os, const HeapElt<T>& elt) {
 	return os;
 }
 
-template<class T>
-std::ostream& operator<<(std::ostream& os, const HeapNode<T>& node) {
-	os  <<*(node.elt) << " ";
-	if (node.left)  os <<  *(node.left);
-	if (node.right) os <<  *(node.right);
-	return os;
-}
-
 template<class T>
 std::ostream& operator<<(std::ostream& os, const SharedHeap<T>& heap) {
-	if (!heap.root) return os << "(empty heap)";
+	if (heap.empty()) return os << "(empty heap)";
 	os << std::endl;
-	std::stack<std::pair<HeapNode<T>*,int> > s;
-	s.push(std::pair<HeapNode<T>*,int>(heap.root,0));
+	std::stack<std::pair<unsigned int,int> > s;
+	s.push(std::pair<unsigned int,int>(0,0));
 	while (!s.empty()) {
-		std::pair<HeapNode<T>*,int> p=s.top();
+		std::pair<unsigned int,int> p=s.top();
 		s.pop();
 		for (int i=0; i<p.second; i++) os << "   ";
-		os  << (p.first->elt->crit[heap.heap_id]) << std::endl;
-		if (p.first->right) s.push(std::pair<HeapNode<T>*,int>(p.first->right,p.second+1));
-		if (p.first->left) s.push(std::pair<HeapNode<T>*,int>(p.first->left,p.second+1));
+		os  << (heap.l[p.first]->crit[heap.heap_id]) << std::endl;
+		unsigned int left=2*p.first+1;
+		if (left+1<heap.l.size()) s.push(std::pair<unsigned int,int>(left+1,p.second+1));
+		if (left<heap.l.size()) s.push(std::pair<unsigned int,int>(left,p.second+1));
 	}
 	return os;
 }
@@ -0,0 +1,33 @@
+/* ============================================================================
+ * I B E X - A small coupled system (for the tests)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "Coupled4.h"
+#include "ibex_SystemFactory.h"
+
+namespace ibex {
+
+Coupled4::Coupled4() : sol(4,1.0) {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprSymbol& z=ExprSymbol::new_("z");
+	const ExprSymbol& w=ExprSymbol::new_("w");
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+	fac.add_var(w);
+	fac.add_ctr(x*y-z=0);
+	fac.add_ctr(y+z*w=1);
+	fac.add_ctr(x+y+z+w=3);
+	fac.add_ctr(x*w-y=-1);
+	sys=new System(fac);
+	sol[3]=0;
+}
+
+} // end namespace ibex
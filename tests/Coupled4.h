@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - A small coupled system (for the tests)
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __COUPLED_4_H__
+#define __COUPLED_4_H__
+
+#include "ibex_System.h"
+#include "ibex_Vector.h"
+
+namespace ibex {
+
+/*
+ * x*y=z, y+z*w=1, x+y+z+w=3, x*w-y=-1
+ *
+ * Every variable appears in several constraints,
+ * so that shaving one variable contracts the others.
+ */
+class Coupled4 {
+public:
+	Coupled4();
+	~Coupled4() { delete sys; }
+
+	System* sys;
+
+	// a solution: (1,1,1,0)
+	Vector sol;
+};
+
+} // end namespace ibex
+
+#endif // __COUPLED_4_H__
@@ -11,6 +11,7 @@
 
 #include "TestAgenda.h"
 #include "ibex_Agenda.h"
+#include "ibex_PriorityAgenda.h"
 #include "utils.h"
 #include <float.h>
 
@@ -128,3 +129,50 @@ void TestAgenda::push01() {
 	CPPUNIT_ASSERT(((i=a.next(i))==a.end()));
 }
 
+
+void TestAgenda::priority01() {
+	PriorityAgenda a(10);
+	a.push(1,0.5);
+	a.push(4,0.2);
+	a.push(0,0.9);
+	a.push(7,0.5);
+	a.push(3,0.2);
+	CPPUNIT_ASSERT(a.nb_elements()==5);
+	int i;
+	a.pop(i);
+	CPPUNIT_ASSERT(i==0);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==1); // same priority as 7 but pushed before
+	a.pop(i);
+	CPPUNIT_ASSERT(i==7);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==4);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==3);
+	CPPUNIT_ASSERT(a.empty());
+}
+
+void TestAgenda::priority02() {
+	PriorityAgenda a(10);
+	a.push(1,0.5);
+	a.push(4,0.2);
+	a.push(7,0.3);
+	a.push(4,0.8); // raised
+	a.push(1,0.1); // not lowered
+	CPPUNIT_ASSERT(a.nb_elements()==3);
+	CPPUNIT_ASSERT(a.contains(4));
+	CPPUNIT_ASSERT(a.priority(4)==0.8);
+	CPPUNIT_ASSERT(a.priority(1)==0.5);
+	int i;
+	a.pop(i);
+	CPPUNIT_ASSERT(i==4);
+	CPPUNIT_ASSERT(!a.contains(4));
+	a.pop(i);
+	CPPUNIT_ASSERT(i==1);
+	a.flush();
+	CPPUNIT_ASSERT(a.empty());
+	CPPUNIT_ASSERT(!a.contains(7));
+	a.push(7,0.1);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==7);
+}
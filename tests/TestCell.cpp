@@ -15,8 +15,15 @@
 #include "ibex_LargestFirst.h"
 #include "ibex_SystemFactory.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_CellList.h"
+#include "ibex_CellDiskList.h"
+#include "ibex_DeltaBoxCoder.h"
 #include "ibex_Cell.h"
 
+#ifndef _WIN32
+#include <thread>
+#endif
+
 //using namespace std;
 
 namespace ibex {
@@ -117,7 +124,248 @@ void TestCell::test02() {
 }
 
 
-} // end namespace
+void TestCell::pool01() {
+	Cell::release_pool();
+	CPPUNIT_ASSERT(Cell::pool_size()==0);
+	CPPUNIT_ASSERT(Cell::box_pool_size()==0);
+
+	IntervalVector box(2, Interval(-1,1));
+	Cell* root = new Cell(box);
+
+	LargestFirst bsc;
+	std::pair<Cell*, Cell*> p = bsc.bisect(*root);
+	delete root;
+	CPPUNIT_ASSERT(Cell::pool_size()==1);
+	CPPUNIT_ASSERT(Cell::box_pool_size()==1);
+
+	// children (and their boxes) are allocated from the free lists
+	std::pair<Cell*, Cell*> q = bsc.bisect(*p.first);
+	CPPUNIT_ASSERT(Cell::pool_size()==0);
+	CPPUNIT_ASSERT(Cell::box_pool_size()==0);
+	CPPUNIT_ASSERT(q.first->depth==2);
+	check(q.first->box|q.second->box, p.first->box);
+
+	delete p.first;
+	delete p.second;
+	delete q.first;
+	delete q.second;
+	CPPUNIT_ASSERT(Cell::pool_size()==4);
+	CPPUNIT_ASSERT(Cell::box_pool_size()==4);
+
+	// a box of another dimension is not recycled
+	delete new Cell(IntervalVector(3));
+	CPPUNIT_ASSERT(Cell::box_pool_size()==4);
+
+	Cell::release_pool();
+	CPPUNIT_ASSERT(Cell::pool_size()==0);
+	CPPUNIT_ASSERT(Cell::box_pool_size()==0);
+}
 
+void TestCell::pool02() {
+	BlockPool pool(sizeof(Cell), 2);
+	void* b[3];
+	for (int i=0; i<3; i++) b[i]=pool.alloc();
+	for (int i=0; i<3; i++) pool.free(b[i]);
+	// the list is bounded
+	CPPUNIT_ASSERT(pool.size()==2);
+	void* c=pool.alloc();
+	CPPUNIT_ASSERT(pool.size()==1);
+	pool.free(c);
+	pool.clear();
+	CPPUNIT_ASSERT(pool.size()==0);
+}
+
+#ifndef _WIN32
+namespace {
+
+// Deletes its cell when the thread is over. Being constructed before
+// the pools of the thread, it is destroyed after them (like an object
+// with static storage w.r.t. the pools of the main thread).
+struct CellHolder {
+	CellHolder() : cell(NULL) { }
+	~CellHolder() { delete cell; }
+	Cell* cell;
+};
+
+}
+#endif
+
+void TestCell::pool03() {
+#ifndef _WIN32
+	std::thread t([]() {
+		static thread_local CellHolder holder;
+		holder.cell=new Cell(IntervalVector(2, Interval(-1,1)));
+		holder.cell->prop.add(new BxpTest());
+		std::pair<Cell*, Cell*> p=LargestFirst().bisect(*holder.cell);
+		delete p.first;
+		delete p.second;
+	});
+	t.join();
+	// the cell (and its box and property) have been
+	// freed after the pools: the test must not crash.
+#endif
+}
 
+void TestCell::disk_list01() {
+	CellList list;
+	CellDiskList disk_list(8);
 
+	// the same cells are pushed and popped in both
+	// buffers (popped cells are bisected, until depth 6)
+	Cell* root = new Cell(IntervalVector(2, Interval(-1,1)));
+	root->prop.add(new BxpTest());
+	list.push(root);
+	disk_list.push(new Cell(*root));
+
+	LargestFirst bsc;
+	int nb_cells=0;
+	unsigned int max_on_disk=0;
+
+	while (!list.empty()) {
+		CPPUNIT_ASSERT(disk_list.size()==list.size());
+		Cell* c = list.pop();
+		Cell* d = disk_list.pop();
+		nb_cells++;
+
+		CPPUNIT_ASSERT(d->box==c->box);
+		CPPUNIT_ASSERT(d->depth==c->depth);
+		CPPUNIT_ASSERT(d->bisected_var==c->bisected_var);
+		CPPUNIT_ASSERT(d->prop[BxpTest::id]!=NULL);
+
+		if (c->depth<6) {
+			std::pair<Cell*, Cell*> p = bsc.bisect(*c);
+			list.push(p.first);
+			list.push(p.second);
+			p = bsc.bisect(*d);
+			disk_list.push(p.first);
+			disk_list.push(p.second);
+		}
+		if (disk_list.nb_on_disk()>max_on_disk)
+			max_on_disk=disk_list.nb_on_disk();
+
+		delete c;
+		delete d;
+	}
+	CPPUNIT_ASSERT(disk_list.empty());
+	CPPUNIT_ASSERT(nb_cells==127);
+	CPPUNIT_ASSERT(max_on_disk>0);
+
+	// flush with cells in the file
+	for (int i=0; i<20; i++)
+		disk_list.push(new Cell(IntervalVector(2, Interval(i,i+1))));
+	CPPUNIT_ASSERT(disk_list.nb_on_disk()>0);
+	CPPUNIT_ASSERT(disk_list.top()->box[0]==Interval(0,1));
+	disk_list.flush();
+	CPPUNIT_ASSERT(disk_list.empty());
+	CPPUNIT_ASSERT(disk_list.nb_on_disk()==0);
+
+	// the file is reused after the flush (with cells of another size)
+	for (int i=0; i<20; i++)
+		disk_list.push(new Cell(IntervalVector(3, Interval(-i,i))));
+	CPPUNIT_ASSERT(disk_list.nb_on_disk()>0);
+	for (int i=0; i<20; i++) {
+		Cell* c = disk_list.pop();
+		CPPUNIT_ASSERT(c->box==IntervalVector(3, Interval(-i,i)));
+		delete c;
+	}
+	CPPUNIT_ASSERT(disk_list.empty());
+}
+
+void TestCell::disk_list02() {
+	CellList list;
+	// encoded cells kept in memory
+	CellDiskList disk_list(8, false);
+	int n=10;
+
+	Cell* root = new Cell(IntervalVector(n, Interval(-1,1)));
+	root->prop.add(new BxpTest());
+	list.push(root);
+	disk_list.push(new Cell(*root));
+
+	LargestFirst bsc;
+	int nb_cells=0;
+	unsigned int max_on_disk=0;
+
+	while (!list.empty()) {
+		CPPUNIT_ASSERT(disk_list.size()==list.size());
+		Cell* c = list.pop();
+		Cell* d = disk_list.pop();
+		nb_cells++;
+
+		CPPUNIT_ASSERT(d->box==c->box);
+		CPPUNIT_ASSERT(d->depth==c->depth);
+		CPPUNIT_ASSERT(d->bisected_var==c->bisected_var);
+		CPPUNIT_ASSERT(d->prop[BxpTest::id]!=NULL);
+
+		if (c->depth<6) {
+			std::pair<Cell*, Cell*> p = bsc.bisect(*c);
+			list.push(p.first);
+			list.push(p.second);
+			p = bsc.bisect(*d);
+			disk_list.push(p.first);
+			disk_list.push(p.second);
+		}
+		if (disk_list.nb_on_disk()>max_on_disk) {
+			max_on_disk=disk_list.nb_on_disk();
+			// an encoded cell is smaller than its box
+			CPPUNIT_ASSERT(disk_list.encoded_size() < (long) (max_on_disk*n*sizeof(Interval)));
+		}
+
+		delete c;
+		delete d;
+	}
+	CPPUNIT_ASSERT(disk_list.empty());
+	CPPUNIT_ASSERT(disk_list.encoded_size()==0);
+	CPPUNIT_ASSERT(nb_cells==127);
+	CPPUNIT_ASSERT(max_on_disk>0);
+
+	for (int i=0; i<20; i++)
+		disk_list.push(new Cell(IntervalVector(n, Interval(i,i+1))));
+	CPPUNIT_ASSERT(disk_list.nb_on_disk()>0);
+	disk_list.flush();
+	CPPUNIT_ASSERT(disk_list.empty());
+	CPPUNIT_ASSERT(disk_list.encoded_size()==0);
+}
+
+void TestCell::delta_coder01() {
+	DeltaBoxCoder enc(3);
+	DeltaBoxCoder dec(3);
+	unsigned char* buf=new unsigned char[enc.max_size()];
+
+	IntervalVector box(3, Interval(-1,1));
+	IntervalVector res(3);
+
+	// first box: all the bounds are stored
+	int size=enc.encode(box, buf);
+	CPPUNIT_ASSERT(size==enc.max_size());
+	CPPUNIT_ASSERT(dec.decode(buf, res)==size);
+	CPPUNIT_ASSERT(res==box);
+
+	// one bound changed
+	box[1]=Interval(-1,0.1);
+	size=enc.encode(box, buf);
+	CPPUNIT_ASSERT(size==enc.max_size()-5*(int)sizeof(double));
+	CPPUNIT_ASSERT(dec.decode(buf, res)==size);
+	CPPUNIT_ASSERT(res==box);
+
+	// empty box (the previous box is kept)
+	size=enc.encode(IntervalVector::empty(3), buf);
+	CPPUNIT_ASSERT(dec.decode(buf, res)==size);
+	CPPUNIT_ASSERT(res.is_empty());
+
+	box[0]=Interval(0,POS_INFINITY);
+	size=enc.encode(box, buf);
+	CPPUNIT_ASSERT(size==enc.max_size()-4*(int)sizeof(double));
+	CPPUNIT_ASSERT(dec.decode(buf, res)==size);
+	CPPUNIT_ASSERT(res==box);
+
+	enc.reset();
+	dec.reset();
+	CPPUNIT_ASSERT(enc.encode(box, buf)==enc.max_size());
+	dec.decode(buf, res);
+	CPPUNIT_ASSERT(res==box);
+
+	delete[] buf;
+}
+
+} // end namespace
@@ -15,6 +15,7 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include "ibex_Bxp.h"
+#include "ibex_BlockPool.h"
 #include "utils.h"
 
 namespace ibex {
@@ -47,10 +48,23 @@ public:
 	CPPUNIT_TEST_SUITE(TestCell);
 	CPPUNIT_TEST(test01);
 	CPPUNIT_TEST(test02);
+	CPPUNIT_TEST(pool01);
+	CPPUNIT_TEST(pool02);
+	CPPUNIT_TEST(pool03);
+	CPPUNIT_TEST(disk_list01);
+	CPPUNIT_TEST(disk_list02);
+	CPPUNIT_TEST(delta_coder01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
+	void pool01();
+	void pool02();
+	// a cell freed after the destruction of the pools
+	void pool03();
+	void disk_list01();
+	void disk_list02();
+	void delta_coder01();
 
 };
 
@@ -0,0 +1,65 @@
+/* ============================================================================
+ * I B E X - 3BCID Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtc3BCid.h"
+#include "Coupled4.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_CtcHC4.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtc3BCid::parallel01() {
+	Coupled4 p;
+	System* sys=p.sys;
+	CtcHC4 hc4(*sys);
+
+	// the clones are built on their own copy of the system
+	System sys1(*sys), sys2(*sys);
+	CtcHC4 hc4_1(sys1), hc4_2(sys2);
+
+	Ctc3BCid seq(hc4);
+	Ctc3BCid par(hc4);
+	par.set_parallel(Array<Ctc>(hc4_1,hc4_2));
+
+	IntervalVector box(4,Interval(-10,10));
+	IntervalVector box_seq(box);
+	IntervalVector box_par(box);
+	seq.contract(box_seq);
+	par.contract(box_par);
+
+	CPPUNIT_ASSERT(box_seq.is_strict_subset(box));
+	CPPUNIT_ASSERT(box_seq.is_subset(box_par));
+	CPPUNIT_ASSERT(box_par.is_subset(box));
+	CPPUNIT_ASSERT(box_par.contains(p.sol));
+}
+
+void TestCtc3BCid::parallel02() {
+	Coupled4 p;
+	System* sys=p.sys;
+	CtcHC4 hc4(*sys);
+	System sys1(*sys);
+	CtcHC4 hc4_1(sys1);
+
+	Ctc3BCid seq(hc4);
+	Ctc3BCid par(hc4);
+	par.set_parallel(Array<Ctc>(hc4_1));
+	par.set_parallel(Array<Ctc>()); // back to 1 thread
+
+	IntervalVector box(4,Interval(-10,10));
+	IntervalVector box_seq(box);
+	IntervalVector box_par(box);
+	seq.contract(box_seq);
+	par.contract(box_par);
+
+	CPPUNIT_ASSERT(box_par==box_seq);
+}
+
+} // end namespace ibex
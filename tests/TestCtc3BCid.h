@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - 3BCID Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_3BCID_H__
+#define __TEST_CTC_3BCID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtc3BCid : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtc3BCid);
+	CPPUNIT_TEST(parallel01);
+	CPPUNIT_TEST(parallel02);
+	CPPUNIT_TEST_SUITE_END();
+
+	// parallel shaving: contains the sequential result
+	void parallel01();
+
+	// parallel shaving with 1 thread: same as sequential
+	void parallel02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtc3BCid);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_3BCID_H__
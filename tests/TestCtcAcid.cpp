@@ -0,0 +1,68 @@
+/* ============================================================================
+ * I B E X - ACID Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcAcid.h"
+#include "Coupled4.h"
+#include "ibex_CtcAcid.h"
+#include "ibex_CtcHC4.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// boxes around the solution, of decreasing size
+IntervalVector acid_box(const Vector& sol, int i) {
+	double r=10.0/(1+i%25);
+	IntervalVector box(sol.size());
+	for (int j=0; j<sol.size(); j++)
+		box[j]=Interval(sol[j]-r*(1+0.1*j), sol[j]+r);
+	return box;
+}
+
+}
+
+void TestCtcAcid::parallel01() {
+	Coupled4 p;
+
+	// the clones are built on their own copy of the system
+	System sys1(*p.sys), sys2(*p.sys);
+	CtcHC4 hc4(*p.sys), hc4_1(sys1), hc4_2(sys2);
+
+	CtcAcid seq(*p.sys,hc4);
+	CtcAcid par(*p.sys,hc4);
+	par.set_parallel(Array<Ctc>(hc4_1,hc4_2));
+
+	// more calls than the first tuning phase (50 calls)
+	const int nb_calls=60;
+
+	// note: nbvar_stat() is shared by all the instances
+	// and set at the end of a tuning phase.
+	for (int i=0; i<nb_calls; i++) {
+		IntervalVector box=acid_box(p.sol,i);
+		seq.contract(box);
+	}
+	double seq_stat=seq.nbvar_stat();
+
+	for (int i=0; i<nb_calls; i++) {
+		IntervalVector box=acid_box(p.sol,i);
+		par.contract(box);
+		CPPUNIT_ASSERT(box.contains(p.sol));
+	}
+	double par_stat=par.nbvar_stat();
+
+	// the gains measured by the threads lead to
+	// (about) the same number of variables
+	CPPUNIT_ASSERT(seq_stat>0);
+	CPPUNIT_ASSERT(par_stat>0);
+	CPPUNIT_ASSERT(fabs(par_stat-seq_stat)<=1);
+}
+
+} // end namespace ibex
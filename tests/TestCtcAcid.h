@@ -0,0 +1,36 @@
+/* ============================================================================
+ * I B E X - ACID Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_ACID_H__
+#define __TEST_CTC_ACID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcAcid : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcAcid);
+	CPPUNIT_TEST(parallel01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// parallel shaving: adaptive tuning of the number
+	// of shaved variables (compared with sequential)
+	void parallel01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcAcid);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_ACID_H__
@@ -13,6 +13,9 @@
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
 #include "ibex_Array.h"
+#include "ibex_CtcPropag.h"
+
+#include <thread>
 
 namespace ibex {
 
@@ -55,4 +58,137 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+void TestCtcHC4::ponts30_priority() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++) {
+		Function* fi=dynamic_cast<Function*>(&((*p30.f)[i]));
+		ctr[i]=new NumConstraint(*fi,EQ);
+	}
+
+	Array<NumConstraint> a(ctr,30);
+	CtcHC4 hc4(a,0.1);
+	hc4.accumulate=true;
+	hc4.priority=true;
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+
+	CPPUNIT_ASSERT(almost_eq(box, p30.hc4_box,1e-04));
+
+	for (int i=0; i<30; i++) {
+		delete ctr[i];
+	}
+}
+
+namespace {
+
+/*
+ * Contractor on x[i] and x[i+1] that enforces x[i+1] <= x[i]-1
+ * (idempotent) and records the impact it is called with.
+ */
+class CtcDecr : public Ctc {
+public:
+	CtcDecr(int n, int i) : Ctc(n), i(i) {
+		input = new BitSet(n);
+		output = new BitSet(n);
+		input->add(i);
+		input->add(i+1);
+		output->add(i);
+		output->add(i+1);
+	}
+
+	virtual void contract(IntervalVector& box) {
+		ContractContext context(box);
+		contract(box,context);
+	}
+
+	virtual void contract(IntervalVector& box, ContractContext& context) {
+		impacts.push_back(context.impact);
+		box[i+1] &= box[i]-1;
+		box[i] &= box[i+1]+1;
+		if (box.is_empty()) box.set_empty();
+		context.output_flags.add(FIXPOINT);
+	}
+
+	int i;
+	std::vector<BitSet> impacts;
+};
+
+}
+
+void TestCtcHC4::priority_impact() {
+	CtcDecr c0(3,0);
+	CtcDecr c1(3,1);
+	CtcPropag propag(Array<Ctc>(c0,c1));
+	propag.priority=true;
+
+	IntervalVector box(3,Interval(0,10));
+	propag.contract(box);
+
+	CPPUNIT_ASSERT(box[0]==Interval(2,10));
+	CPPUNIT_ASSERT(box[1]==Interval(1,9));
+	CPPUNIT_ASSERT(box[2]==Interval(0,8));
+
+	// first call: all variables are impacted
+	CPPUNIT_ASSERT(c0.impacts.size()==2);
+	CPPUNIT_ASSERT(c0.impacts[0].size()==3);
+	// c0 is called again because x[1] has been reduced by c1
+	// (x[0] is not reported).
+	CPPUNIT_ASSERT(c0.impacts[1].size()==1);
+	CPPUNIT_ASSERT(c0.impacts[1][1]);
+}
+
+namespace {
+
+NumConstraint* coupled_ctr(int i) {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	switch (i) {
+	case 0:  return new NumConstraint(x,y,z,x*y+z=1);
+	case 1:  return new NumConstraint(x,y,z,x-y*z=0);
+	default: return new NumConstraint(x,y,z,x+exp(y)-z=1);
+	}
+}
+
+}
+
+void TestCtcHC4::incremental_revise() {
+	NumConstraint* ctr[3];
+	NumConstraint* ctr2[3];
+	for (int i=0; i<3; i++) {
+		ctr[i]=coupled_ctr(i);
+		ctr2[i]=coupled_ctr(i);
+	}
+
+	CtcHC4 hc4(Array<NumConstraint>(ctr,3),0.01);
+	CtcHC4 hc4_incr(Array<NumConstraint>(ctr2,3),0.01);
+	hc4_incr.set_incremental_revise(true);
+
+	// same contraction as in normal mode, including in
+	// another thread (that has its own evaluators)
+	bool same=true;
+	bool incr_thread=false;
+	std::thread t([&]() {
+		for (int k=0; k<10; k++) {
+			IntervalVector box(3,Interval(-1-k,2+0.5*k));
+			IntervalVector box2(box);
+			hc4.contract(box);
+			hc4_incr.contract(box2);
+			same &= (box==box2);
+		}
+		incr_thread=ctr2[0]->f.hc4revise().incremental;
+	});
+	t.join();
+	CPPUNIT_ASSERT(same);
+	CPPUNIT_ASSERT(incr_thread);
+	CPPUNIT_ASSERT(!ctr[0]->f.hc4revise().incremental);
+
+	for (int i=0; i<3; i++) {
+		delete ctr[i];
+		delete ctr2[i];
+	}
+}
+
 } // end namespace ibex
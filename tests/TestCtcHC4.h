@@ -23,9 +23,16 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcHC4);
 	
 		CPPUNIT_TEST(ponts30);
+		CPPUNIT_TEST(ponts30_priority);
+		CPPUNIT_TEST(priority_impact);
+		CPPUNIT_TEST(incremental_revise);
 	CPPUNIT_TEST_SUITE_END();
 
 	void ponts30();
+	void ponts30_priority();
+	void priority_impact();
+	// incremental forward-backward: same as normal mode
+	void incremental_revise();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcHC4);
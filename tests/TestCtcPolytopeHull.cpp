@@ -68,4 +68,38 @@ void TestCtcPolytopeHull::fixbug01() {
 }
 
 
+void TestCtcPolytopeHull::parallel01() {
+	double _A[4]= {1,1,1,-1};
+	Matrix A(2,2,_A);
+	Vector b=Vector::zeros(2);
+
+	CtcPolytopeHull ctc(A,b);
+	ctc.set_nb_threads(2);
+
+	IntervalVector box(2,Interval(-1,1));
+
+	// contract twice: the copies of the linear solver are reused
+	for (int i=0; i<2; i++) {
+		ctc.contract(box);
+		check(box[0],Interval(-1,0));
+		check(box[1],Interval(-1,1));
+		CPPUNIT_ASSERT(box[0].is_superset(Interval(-1,0)));
+		CPPUNIT_ASSERT(box[1].is_superset(Interval(-1,1)));
+	}
+}
+
+void TestCtcPolytopeHull::parallel02() {
+	// x+y+z<=-2 is infeasible in [0,1]^3
+	double _A[3]= {1,1,1};
+	Matrix A(1,3,_A);
+	Vector b(1,-2.0);
+
+	CtcPolytopeHull ctc(A,b);
+	ctc.set_nb_threads(3);
+
+	IntervalVector box(3,Interval(0,1));
+	ctc.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
 } // end namespace ibex
@@ -27,6 +27,8 @@ public:
 
 		CPPUNIT_TEST(lp01);
 		CPPUNIT_TEST(fixbug01);
+		CPPUNIT_TEST(parallel01);
+		CPPUNIT_TEST(parallel02);
 
 #endif //__IBEX_NO_LP_SOLVER__
 
@@ -35,6 +37,10 @@ public:
 	void lp01();
 
 	void fixbug01();
+
+	void parallel01();
+
+	void parallel02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
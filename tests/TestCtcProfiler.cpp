@@ -0,0 +1,109 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcProfiler.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "TestCtcProfiler.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFixPoint.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcIdentity.h"
+#include "ibex_Timer.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtcProfiler::instrument01() {
+	Variable x;
+	Function f(x,x);
+	CtcFwdBwd c1(f,Interval(0,5));
+	CtcIdentity c2(1);
+	CtcCompo compo(c1,c2);
+	CtcFixPoint fp(compo);
+
+	Profiler profiler;
+	{
+		CtcProfilerScope scope(&profiler);
+		scope.add(fp);
+
+		CPPUNIT_ASSERT(&compo.list[0]!=&c1);
+
+		IntervalVector box(1,Interval(0,10));
+		fp.contract(box);
+		check(box,IntervalVector(1,Interval(0,5)));
+	}
+
+	// the original contractors are back
+	CPPUNIT_ASSERT(&compo.list[0]==&c1);
+	CPPUNIT_ASSERT(&compo.list[1]==&c2);
+
+	CPPUNIT_ASSERT(profiler.entries().size()==2);
+	const Profiler::Entry& e1=*profiler.entries()[0];
+	const Profiler::Entry& e2=*profiler.entries()[1];
+	CPPUNIT_ASSERT(e1.name=="0 CtcFwdBwd");
+	CPPUNIT_ASSERT(e2.name=="1 CtcIdentity");
+	CPPUNIT_ASSERT(e1.calls>=1);
+	CPPUNIT_ASSERT(e1.calls==e2.calls);
+	CPPUNIT_ASSERT(e1.empty==0);
+	// first call: [0,10] -> [0,5], then no reduction
+	CPPUNIT_ASSERT(e1.volume_ratio()<1.0);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,e2.volume_ratio(),1e-10);
+}
+
+void TestCtcProfiler::empty01() {
+	Variable x;
+	Function f(x,x);
+	CtcFwdBwd c1(f,Interval(0,5));
+	CtcIdentity c2(1);
+	CtcCompo compo(c1,c2);
+
+	Profiler profiler;
+	CtcProfiler::instrument(compo,profiler);
+
+	IntervalVector box(1,Interval(6,10));
+	compo.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	CtcProfiler::restore(compo);
+
+	CPPUNIT_ASSERT(profiler.entries().size()==2);
+	CPPUNIT_ASSERT(profiler.entries()[0]->calls==1);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,profiler.entries()[0]->empty_rate(),1e-10);
+	// the composition stops at the first empty box
+	CPPUNIT_ASSERT(profiler.entries()[1]->calls==0);
+}
+
+namespace {
+
+class CtcTimeOut : public Ctc {
+public:
+	CtcTimeOut() : Ctc(1) { }
+	void contract(IntervalVector& box) { throw TimeOutException(); }
+};
+
+}
+
+void TestCtcProfiler::timeout01() {
+	CtcTimeOut c;
+
+	Profiler profiler;
+	CtcProfiler p(c,profiler,"timeout");
+
+	IntervalVector box(1,Interval(0,10));
+	bool thrown=false;
+	try {
+		p.contract(box);
+	} catch(TimeOutException&) {
+		thrown=true;
+	}
+	CPPUNIT_ASSERT(thrown);
+	// a time out is not an empty box
+	CPPUNIT_ASSERT(profiler.entries()[0]->empty==0);
+}
+
+} // namespace ibex
@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - CtcProfiler Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_PROFILER_H__
+#define __TEST_CTC_PROFILER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ibex_CtcProfiler.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcProfiler : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcProfiler);
+	CPPUNIT_TEST(instrument01);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(timeout01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void instrument01();
+	void empty01();
+	void timeout01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcProfiler);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_PROFILER_H__
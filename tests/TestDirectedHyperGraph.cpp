@@ -0,0 +1,68 @@
+/* ============================================================================
+ * I B E X - TestDirectedHyperGraph
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#include "TestDirectedHyperGraph.h"
+#include "ibex_DirectedHyperGraph.h"
+
+using namespace std;
+
+namespace {
+
+bool equals(const DirectedHyperGraph::Range& r, int n, const int* l) {
+	if (r.size()!=n) return false;
+	for (int i=0; i<n; i++)
+		if (r.begin()[i]!=l[i]) return false;
+	return true;
+}
+
+}
+
+void TestDirectedHyperGraph::test01() {
+	// c0: x0,x2 -> x1
+	// c1: x1 -> x0,x1
+	DirectedHyperGraph g(2,3);
+	g.add_arc(0,2,true);
+	g.add_arc(0,0,true);
+	g.add_arc(0,1,false);
+	g.add_arc(1,1,true);
+	g.add_arc(1,1,false);
+	g.add_arc(1,0,false);
+	g.build();
+
+	int _02[]={0,2};
+	int _01[]={0,1};
+	int _0[]={0};
+	int _1[]={1};
+
+	CPPUNIT_ASSERT(equals(g.input_vars(0),2,_02));
+	CPPUNIT_ASSERT(equals(g.output_vars(0),1,_1));
+	CPPUNIT_ASSERT(equals(g.input_vars(1),1,_1));
+	CPPUNIT_ASSERT(equals(g.output_vars(1),2,_01));
+
+	CPPUNIT_ASSERT(equals(g.output_ctrs(0),1,_0));
+	CPPUNIT_ASSERT(equals(g.input_ctrs(0),1,_1));
+	CPPUNIT_ASSERT(equals(g.output_ctrs(1),1,_1));
+	CPPUNIT_ASSERT(equals(g.input_ctrs(1),2,_01));
+	CPPUNIT_ASSERT(equals(g.output_ctrs(2),1,_0));
+	CPPUNIT_ASSERT(g.input_ctrs(2).empty());
+}
+
+void TestDirectedHyperGraph::duplicates() {
+	DirectedHyperGraph g(1,2);
+	g.add_arc(0,1,true);
+	g.add_arc(0,1,true);
+	g.add_arc(0,0,true);
+	g.build();
+
+	int _01[]={0,1};
+	int _0[]={0};
+	CPPUNIT_ASSERT(equals(g.input_vars(0),2,_01));
+	CPPUNIT_ASSERT(equals(g.output_ctrs(1),1,_0));
+	CPPUNIT_ASSERT(g.output_vars(0).empty());
+}
@@ -0,0 +1,34 @@
+/* ============================================================================
+ * I B E X - TestDirectedHyperGraph
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_DIRECTED_HYPER_GRAPH_H__
+#define __TEST_DIRECTED_HYPER_GRAPH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestDirectedHyperGraph : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestDirectedHyperGraph);
+	CPPUNIT_TEST(test01);
+	CPPUNIT_TEST(duplicates);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void test01();
+	void duplicates();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestDirectedHyperGraph);
+
+#endif // __TEST_DIRECTED_HYPER_GRAPH_H__
@@ -246,4 +246,76 @@ void TestDoubleHeap::test05() {
 }
 
 
+void TestDoubleHeap::test06() {
+
+    int nb= 1000;
+    TestCostFunc1 costf1;
+    TestCostFunc2 costf2;
+
+    DoubleHeap<Interval> h(costf1,false,costf2,false,50);
+
+    for (int i=0; i<nb; i++) {
+            double a=(i*37)%nb;
+            h.push(new Interval(a,a+(i*71)%nb));
+    }
+
+    // alternate pops from the two heaps
+    for (int i=0; i<nb/4; i++) {
+            double min1=h.minimum1();
+            Interval* x=h.pop1();
+            CPPUNIT_ASSERT(x->diam()==min1);
+            CPPUNIT_ASSERT(h.minimum1()>=min1);
+            delete x;
+
+            double min2=h.minimum2();
+            x=h.pop2();
+            CPPUNIT_ASSERT(x->lb()==min2);
+            CPPUNIT_ASSERT(h.minimum2()>=min2);
+            delete x;
+    }
+
+    h.contract(500);
+    CPPUNIT_ASSERT(h.size()>0);
+
+    double min1=NEG_INFINITY;
+    unsigned int n=h.size();
+    for (unsigned int i=0; i<n; i++) {
+            Interval* x=h.pop1();
+            CPPUNIT_ASSERT(x->diam()<=500);
+            CPPUNIT_ASSERT(x->diam()>=min1);
+            min1=x->diam();
+            delete x;
+    }
+    CPPUNIT_ASSERT(h.empty());
+}
+
+void TestDoubleHeap::test07() {
+
+    int nb= 1000;
+    TestCostFunc2 costf2;
+    TestCostFunc3 costf3;
+
+    DoubleHeap<Interval> h(costf2,false,costf3,true,50);
+
+    for (int i=0; i<nb; i++) {
+            h.push(new Interval(i,i+1));
+    }
+
+    // a few contractions, with few data removed each time
+    for (int k=1; k<=5; k++) {
+            costf3.set_loup(10+k);
+            h.contract(nb-1-k);
+            CPPUNIT_ASSERT(h.size()==(unsigned int) nb-k);
+            CPPUNIT_ASSERT(h.minimum1()==0);
+            CPPUNIT_ASSERT(h.minimum2()==10+k); // cost recalculated with the new loup
+    }
+
+    for (int i=0; i<nb-5; i++) {
+            Interval* x= (i%2==0)? h.pop1() : h.pop2();
+            CPPUNIT_ASSERT(x->lb()==i);
+            delete x;
+    }
+    CPPUNIT_ASSERT(h.empty());
+}
+
 } // end namespace
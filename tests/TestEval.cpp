@@ -15,6 +15,11 @@
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
 
+#ifndef _WIN32
+#include <thread>
+#include <atomic>
+#endif
+
 using namespace std;
 
 //namespace {
@@ -301,4 +306,246 @@ void TestEval::matrix_components() {
 	CPPUNIT_ASSERT(f.basic_evaluator().d[rank_row_1].v()==row1);
 }
 
+void TestEval::threads01() {
+#ifndef _WIN32
+	const ExprSymbol& x1 = ExprSymbol::new_("x1");
+	const ExprSymbol& y1 = ExprSymbol::new_("y1");
+	const ExprSymbol& x2 = ExprSymbol::new_("x2");
+	const ExprSymbol& y2 = ExprSymbol::new_("y2");
+
+	Function f1(x1,y1,x1*y1+sin(x1),"f1");
+	Function f2(x2,y2,f1(x2,x2+y2)+sqr(y2),"f2");
+
+	const int nb_threads=4;
+	const int nb_boxes=100;
+
+	vector<IntervalVector> boxes;
+	for (int i=0; i<nb_boxes; i++) {
+		IntervalVector box(2);
+		box[0]=Interval(i,i+0.5);
+		box[1]=Interval(-i,-i+1);
+		boxes.push_back(box);
+	}
+
+	// sequential results
+	vector<Interval> y;
+	vector<IntervalVector> g;
+	for (int i=0; i<nb_boxes; i++) {
+		y.push_back(f2.eval(boxes[i]));
+		g.push_back(f2.gradient(boxes[i]));
+	}
+
+	bool ok[nb_threads];
+
+	vector<thread> threads;
+	for (int k=0; k<nb_threads; k++) {
+		ok[k]=true;
+		threads.push_back(thread([&,k]() {
+			for (int j=0; j<10; j++)
+				for (int i=0; i<nb_boxes; i++) {
+					ok[k] &= (f2.eval(boxes[i])==y[i]);
+					ok[k] &= (f2.gradient(boxes[i])==g[i]);
+				}
+		}));
+	}
+
+	for (int k=0; k<nb_threads; k++) {
+		threads[k].join();
+		CPPUNIT_ASSERT(ok[k]);
+	}
+#endif
+}
+
+void TestEval::threads02() {
+#ifndef _WIN32
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+
+	Function f(x,y,Return(sqr(x)+y,x*y,x-y),"f");
+
+	IntervalVector box(2,Interval(1,2));
+
+	const int nb_threads=4;
+
+	bool ok[nb_threads];
+	const Function* comp[nb_threads];
+	const Function* df[nb_threads];
+
+	// the components and the derivative are
+	// built on demand by concurrent threads
+	vector<thread> threads;
+	for (int k=0; k<nb_threads; k++) {
+		threads.push_back(thread([&,k]() {
+			comp[k]=&f[1];
+			df[k]=&f.diff();
+			ok[k]=(f[1].eval(box)==Interval(1,4)) && (f[2].eval(box)==Interval(-1,1));
+		}));
+	}
+
+	for (int k=0; k<nb_threads; k++) {
+		threads[k].join();
+		CPPUNIT_ASSERT(ok[k]);
+		CPPUNIT_ASSERT(comp[k]==comp[0]);
+		CPPUNIT_ASSERT(df[k]==df[0]);
+	}
+
+	// a function deleted while a thread that
+	// used it is still running
+	const ExprSymbol& x2 = ExprSymbol::new_("x");
+	Function* g=new Function(x2,sqr(x2)+1,"g");
+
+	atomic<int> stage(0);
+	bool ok2=true;
+
+	thread t([&]() {
+		ok2 &= (g->eval(box.subvector(0,0))==Interval(2,5));
+		stage=1;
+		while (stage!=2) this_thread::yield();
+		const ExprSymbol& x3 = ExprSymbol::new_("x");
+		Function h(x3,2*x3,"h");
+		ok2 &= (h.eval(box.subvector(0,0))==Interval(2,4));
+	});
+
+	while (stage!=1) this_thread::yield();
+	delete g;
+	stage=2;
+	t.join();
+	CPPUNIT_ASSERT(ok2);
+#endif
+}
+
+void TestEval::threads03() {
+#ifndef _WIN32
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	Function f(x,sqr(x)+1,"f");
+
+	IntervalVector box(1,Interval(1,2));
+
+	// one thread after the other
+	const int nb_threads=3;
+	bool ok[nb_threads];
+	const Eval* eval[nb_threads];
+
+	for (int k=0; k<nb_threads; k++) {
+		thread t([&,k]() {
+			eval[k]=&f.basic_evaluator();
+			ok[k]=(f.eval(box)==Interval(2,5));
+		});
+		t.join();
+		CPPUNIT_ASSERT(ok[k]);
+		CPPUNIT_ASSERT(eval[k]!=&f.basic_evaluator());
+		CPPUNIT_ASSERT(eval[k]==eval[0]);
+	}
+#endif
+}
+
+namespace {
+
+// note: x[0] appears twice (two different nodes)
+const ExprNode& tape_expr(const ExprSymbol& x, const ExprSymbol& y) {
+	return x[0]*y+sqr(x[1])-exp(x[2])/(1+y)+abs(x[0])+sqrt(x[2]-0.5);
+}
+
+}
+
+void TestEval::tape01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,tape_expr(x,y));
+	CPPUNIT_ASSERT(f.cf.has_tape());
+
+	// the first component of g is evaluated with the domains of the nodes
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y2 = ExprSymbol::new_("y");
+	Function g(x2,y2,Return(tape_expr(x2,y2),y2));
+	CPPUNIT_ASSERT(!g.cf.has_tape());
+
+	for (int i=0; i<10; i++) {
+		IntervalVector box(4);
+		box[0]=Interval(-i,i+0.5);
+		box[1]=Interval(i,i+1);
+		box[2]=Interval(0.25*i,i);
+		box[3]=Interval(i,2*i);
+		CPPUNIT_ASSERT(f.eval(box)==g.eval_vector(box)[0]);
+		CPPUNIT_ASSERT(f.eval(box)==f.basic_evaluator().eval(box).i());
+	}
+
+	// outside the definition domain
+	CPPUNIT_ASSERT(f.eval(IntervalVector(4,Interval(0,0.1))).is_empty());
+}
+
+void TestEval::tape02() {
+	const ExprSymbol& x1 = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f1(x1,x1);
+	CPPUNIT_ASSERT(!f1.cf.has_tape());
+
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f2(x2,x2*x2);
+	CPPUNIT_ASSERT(!f2.cf.has_tape());
+
+	const ExprSymbol& x3 = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f3(x3,Return(x3[0],x3[1]+1));
+	CPPUNIT_ASSERT(!f3.cf.has_tape());
+
+	const ExprSymbol& x4 = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f4(x4,x4[1]+1);
+	CPPUNIT_ASSERT(f4.cf.has_tape());
+	CPPUNIT_ASSERT(f4.eval(IntervalVector(2,Interval(0,1)))==Interval(1,2));
+}
+
+namespace {
+
+// N boxes, one of which (the last one) is outside the definition domain of tape_expr
+IntervalMatrix batch_boxes(int N) {
+	IntervalMatrix boxes(4,N);
+	for (int j=0; j<N; j++) {
+		boxes[0][j]=Interval(-j,j+0.5);
+		boxes[1][j]=Interval(j,j+1);
+		boxes[2][j]=Interval(0.25*j,j);
+		boxes[3][j]=Interval(j,2*j);
+	}
+	boxes.set_col(N-1,IntervalVector(4,Interval(0,0.1)));
+	return boxes;
+}
+
+}
+
+void TestEval::batch01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,tape_expr(x,y));
+	CPPUNIT_ASSERT(f.cf.has_tape());
+
+	for (int N=1; N<=20; N+=19) {
+		IntervalMatrix boxes=batch_boxes(N);
+		IntervalVector res(N);
+		f.eval_batch(boxes,res);
+		for (int j=0; j<N; j++)
+			CPPUNIT_ASSERT(res[j]==f.basic_evaluator().eval(boxes.col(j)).i());
+		CPPUNIT_ASSERT(res[N-1].is_empty());
+	}
+}
+
+void TestEval::batch02() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,tape_expr(x,y));
+
+	// the same function with an application (no tape)
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y2 = ExprSymbol::new_("y");
+	Function g(x2,y2,Return(tape_expr(x2,y2),y2));
+	const ExprSymbol& x3 = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y3 = ExprSymbol::new_("y");
+	Function h(x3,y3,g(x3,y3)[0]);
+	CPPUNIT_ASSERT(!h.cf.has_tape());
+
+	IntervalMatrix boxes=batch_boxes(20);
+	IntervalVector res(20);
+	IntervalVector res2(20);
+	f.eval_batch(boxes,res);
+	h.eval_batch(boxes,res2);
+	CPPUNIT_ASSERT(res==res2);
+}
+
 } // end namespace
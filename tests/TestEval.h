@@ -37,6 +37,13 @@ public:
 	CPPUNIT_TEST(eval_components01);
 	CPPUNIT_TEST(eval_components02);
 	CPPUNIT_TEST(matrix_components);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
+	CPPUNIT_TEST(threads03);
+	CPPUNIT_TEST(tape01);
+	CPPUNIT_TEST(tape02);
+	CPPUNIT_TEST(batch01);
+	CPPUNIT_TEST(batch02);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -57,6 +64,22 @@ public:
 	// check in particular that the components that are not selected are not computed uselessly
 	void matrix_components();
 
+	// concurrent evaluations of the same function (with a sub-function)
+	void threads01();
+	void threads02();
+	// the evaluators of a thread that is over are reused
+	void threads03();
+
+	// compact tape: same result as with the domains of the nodes
+	void tape01();
+	// compact tape: no tape for non scalar-only functions
+	void tape02();
+
+	// batch evaluation (with a compact tape)
+	void batch01();
+	// batch evaluation (without tape)
+	void batch02();
+
 private:
 	void check_deco(Function& f, const ExprNode& e);
 };
@@ -662,5 +662,27 @@ void TestGradient::jacobian_components02() {
 
 }
 
+void TestGradient::sparse_jacobian01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+
+	Function f(x,y,z,Return(x*y,sin(z),2*x+3*z));
+
+	vector<vector<int> > pattern=f.jacobian_pattern();
+	CPPUNIT_ASSERT(pattern.size()==3);
+	CPPUNIT_ASSERT(pattern[0].size()==2 && pattern[0][0]==0 && pattern[0][1]==1);
+	CPPUNIT_ASSERT(pattern[1].size()==1 && pattern[1][0]==2);
+	CPPUNIT_ASSERT(pattern[2].size()==2 && pattern[2][0]==0 && pattern[2][1]==2);
+
+	double _box[][2] = { {1,2},{3,4},{0,1} };
+	IntervalVector box(3,_box);
+
+	SparseIntervalMatrix J(3,3,pattern);
+	f.jacobian(box,J);
+	CPPUNIT_ASSERT(J.nb_entries()==5);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+}
+
 } // end namespace
 
@@ -16,6 +16,8 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_HC4Revise.h"
 
+#include <thread>
+
 using namespace std;
 
 namespace ibex {
@@ -187,5 +189,118 @@ void TestHC4Revise::issue431() {
 	CPPUNIT_ASSERT(x[0]==Interval::zero());
 }
 
-} // end namespace
+namespace {
+
+// note: x[0] appears twice (two different nodes)
+const ExprNode& tape_expr(const ExprSymbol& x, const ExprSymbol& y) {
+	return x[0]*y+sqr(x[1])-exp(y)+x[0];
+}
+
+}
 
+void TestHC4Revise::tape01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,tape_expr(x,y));
+	CPPUNIT_ASSERT(f.cf.has_tape());
+
+	// the first component of g is contracted with the domains of the nodes
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y2 = ExprSymbol::new_("y");
+	Function g(x2,y2,Return(tape_expr(x2,y2),y2));
+	CPPUNIT_ASSERT(!g.cf.has_tape());
+
+	IntervalVector image(2,Interval::all_reals());
+	image[0]=Interval(-1,1);
+
+	for (int i=0; i<10; i++) {
+		IntervalVector box(3);
+		box[0]=Interval(-i,i+0.5);
+		box[1]=Interval(-1,i+1);
+		box[2]=Interval(-1,0.1*i);
+		IntervalVector box2(box);
+		f.backward(image[0],box);
+		g.backward(image,box2);
+		CPPUNIT_ASSERT(box==box2);
+	}
+
+	IntervalVector box(3,Interval(0,1));
+	f.backward(Interval(10,20),box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestHC4Revise::batch01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,tape_expr(x,y));
+	CPPUNIT_ASSERT(f.cf.has_tape());
+
+	int N=10;
+	IntervalMatrix boxes(3,N);
+	IntervalVector image(N);
+	for (int j=0; j<N; j++) {
+		boxes[0][j]=Interval(-j,j+0.5);
+		boxes[1][j]=Interval(-1,j+1);
+		boxes[2][j]=Interval(-1,0.1*j);
+		image[j]=Interval(-1,1);
+	}
+	image[N-1]=Interval(1000,2000); // infeasible
+
+	IntervalMatrix boxes2(boxes);
+	f.backward_batch(image,boxes);
+
+	for (int j=0; j<N; j++) {
+		IntervalVector box=boxes2.col(j);
+		f.backward(image[j],box);
+		CPPUNIT_ASSERT(boxes.col(j)==box);
+	}
+	CPPUNIT_ASSERT(boxes.col(N-1).is_empty());
+}
+
+void TestHC4Revise::incremental01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	Function f(x,y,z,tape_expr(x,y)+sqrt(z)*log(z+1)-cos(y));
+	CPPUNIT_ASSERT(f.cf.has_tape());
+
+	const ExprSymbol& x2 = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y2 = ExprSymbol::new_("y");
+	const ExprSymbol& z2 = ExprSymbol::new_("z");
+	Function g(x2,y2,z2,tape_expr(x2,y2)+sqrt(z2)*log(z2+1)-cos(y2));
+	g.hc4revise().incremental=true;
+
+	IntervalVector box(4,Interval(-5,5));
+	IntervalVector box2(box);
+
+	// only a few variables change from one call to the other,
+	// and the box is not always contracted
+	for (int i=0; i<20; i++) {
+		Interval image=(i%3==0)? Interval(-1,1) : Interval(-100,100);
+		if (i==10) { box=IntervalVector(4,Interval(-5,5)); box2=box; }
+		box[i%4]=box2[i%4]=Interval(-5+0.1*i,5-0.2*i);
+		f.backward(image,box);
+		g.backward(image,box2);
+		CPPUNIT_ASSERT(box==box2);
+		if (box.is_empty()) break;
+	}
+
+	box=IntervalVector(4,Interval(-2,-1)); // outside the definition domain
+	g.backward(Interval(-1,1),box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestHC4Revise::incremental02() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,tape_expr(x,y));
+	f.hc4revise().incremental=true;
+
+	// the HC4Revise of another thread inherits the flag
+	bool incr=false;
+	std::thread t([&]() { incr=f.hc4revise().incremental; });
+	t.join();
+	CPPUNIT_ASSERT(incr);
+}
+
+} // end namespace
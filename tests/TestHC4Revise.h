@@ -39,6 +39,10 @@ public:
 	CPPUNIT_TEST(vec02);
 	CPPUNIT_TEST(vec03);
 	CPPUNIT_TEST(issue431);
+	CPPUNIT_TEST(tape01);
+	CPPUNIT_TEST(batch01);
+	CPPUNIT_TEST(incremental01);
+	CPPUNIT_TEST(incremental02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void id01();
@@ -61,6 +65,18 @@ public:
 	// domain of f.
 	void issue431();
 
+	// compact tape: same contraction as with the domains of the nodes
+	void tape01();
+
+	// batch contraction: same as with one box at a time
+	void batch01();
+
+	// incremental mode: same as normal mode
+	void incremental01();
+
+	// incremental mode in another thread
+	void incremental02();
+
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestHC4Revise);
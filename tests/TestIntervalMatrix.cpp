@@ -445,3 +445,79 @@ void TestIntervalMatrix::diam01() {
 	CPPUNIT_ASSERT(R[1][0]==M[1][0].diam());
 	CPPUNIT_ASSERT(R[1][1]==M[1][1].diam());
 }
+
+void TestIntervalMatrix::move01() {
+	IntervalMatrix M(2,3,Interval(0,1));
+	const IntervalVector* p=&M[0];
+	IntervalMatrix N(std::move(M));
+	CPPUNIT_ASSERT(&N[0]==p);
+	CPPUNIT_ASSERT(N==IntervalMatrix(2,3,Interval(0,1)));
+	CPPUNIT_ASSERT(M.nb_rows()==0);
+
+	// same dimensions: the rows of N are kept
+	N=IntervalMatrix(2,3,Interval(1,2));
+	CPPUNIT_ASSERT(&N[0]==p);
+	CPPUNIT_ASSERT(N==IntervalMatrix(2,3,Interval(1,2)));
+
+	// different dimensions
+	N=IntervalMatrix(4,1,Interval(2,3));
+	CPPUNIT_ASSERT(N==IntervalMatrix(4,1,Interval(2,3)));
+}
+
+void TestIntervalMatrix::packed_mul01() {
+	RNG::srand(1);
+	int n=70; // more than one block
+	Matrix C=Matrix::rand(n);
+	IntervalMatrix A=Matrix::rand(n)+Interval(-0.1,0.1)*Matrix::ones(n);
+	A[0][0]=Interval(-1,1); // straddling zero
+	C[1][2]=0;
+
+	PackedIntervalMatrix PA(A);
+	CPPUNIT_ASSERT(PA.is_bounded());
+	PackedIntervalMatrix PR(n,n);
+	mul(C,PA,PR);
+	IntervalMatrix R(n,n);
+	PR.get(R);
+
+	IntervalMatrix expected=C*A;
+	CPPUNIT_ASSERT(almost_eq(R,expected,1e-10));
+	CPPUNIT_ASSERT(R.is_superset(IntervalMatrix(C*A.lb())));
+	CPPUNIT_ASSERT(R.is_superset(IntervalMatrix(C*A.ub())));
+
+	// vector (column) case
+	IntervalVector x=Matrix::rand(n).col(0)+Interval(-0.1,0.1)*Vector::ones(n);
+	PackedIntervalMatrix Px(x);
+	PackedIntervalMatrix Py(n,1);
+	mul(C,Px,Py);
+	IntervalVector y(n);
+	Py.get(y);
+	CPPUNIT_ASSERT(almost_eq(y,C*x,1e-10));
+	CPPUNIT_ASSERT(y.is_superset(IntervalVector(C*x.lb())));
+}
+
+void TestIntervalMatrix::packed_dot01() {
+	double _A[]={ 1, -2,  3,
+	             -1,  0,  2 };
+	IntervalMatrix A=Matrix(2,3,_A)+Interval(-0.5,0.5)*Matrix::ones(2,3);
+	IntervalVector x(3);
+	x[0]=Interval(-1,2);
+	x[1]=Interval(3,4);
+	x[2]=Interval(-5,-4);
+
+	PackedIntervalMatrix PA(A);
+	PackedIntervalMatrix Px(x);
+
+	for (int i=0; i<2; i++) {
+		Interval expected=A[i][0]*x[0]+A[i][1]*x[1]+A[i][2]*x[2];
+		CPPUNIT_ASSERT(almost_eq(dot(PA,i,Px),expected,1e-12));
+		// the products of the bounds are exact here
+		CPPUNIT_ASSERT(dot(PA,i,Px).contains(A[i][0].lb()*x[0].lb()+A[i][1].ub()*x[1].ub()+A[i][2].lb()*x[2].ub()));
+		Interval skip1=A[i][0]*x[0]+A[i][2]*x[2];
+		CPPUNIT_ASSERT(almost_eq(dot(PA,i,Px,1),skip1,1e-12));
+	}
+
+	IntervalVector y(2,Interval::all_reals());
+	CPPUNIT_ASSERT(!PackedIntervalMatrix(y).is_bounded());
+	y.set_empty();
+	CPPUNIT_ASSERT(!PackedIntervalMatrix(y).is_bounded());
+}
@@ -15,6 +15,7 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include "ibex_IntervalMatrix.h"
+#include "ibex_PackedIntervalMatrix.h"
 #include "utils.h"
 
 using namespace ibex;
@@ -77,6 +78,9 @@ public:
 	CPPUNIT_TEST(put01);
 	CPPUNIT_TEST(rad01);
 	CPPUNIT_TEST(diam01);
+	CPPUNIT_TEST(move01);
+	CPPUNIT_TEST(packed_mul01);
+	CPPUNIT_TEST(packed_dot01);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -176,6 +180,14 @@ public:
 	void put01();
 	void rad01();
 	void diam01();
+
+	// test: IntervalMatrix(IntervalMatrix&&), operator=(IntervalMatrix&&)
+	void move01();
+
+	// test: mul(const Matrix&, const PackedIntervalMatrix&, PackedIntervalMatrix&)
+	void packed_mul01();
+	// test: dot(const PackedIntervalMatrix&, int, const PackedIntervalMatrix&, int)
+	void packed_dot01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestIntervalMatrix);
@@ -1068,3 +1068,36 @@ void TestIntervalVector::random02() {
 
 	CPPUNIT_ASSERT(b==r);
 }
+
+void TestIntervalVector::move01() {
+	IntervalVector a(3,Interval(0,1));
+	const Interval* p=&a[0];
+	IntervalVector b(std::move(a));
+
+	CPPUNIT_ASSERT(&b[0]==p); // no copy
+	CPPUNIT_ASSERT(b==IntervalVector(3,Interval(0,1)));
+	CPPUNIT_ASSERT(a.size()==0);
+
+	a=b; // a moved-from vector can be assigned again
+	CPPUNIT_ASSERT(a==b);
+}
+
+void TestIntervalVector::move02() {
+	IntervalVector a(2,Interval(0,1));
+	const Interval* p=&a[0];
+
+	// same size: the storage of a is kept
+	a=IntervalVector(2,Interval(2,3));
+	CPPUNIT_ASSERT(&a[0]==p);
+	CPPUNIT_ASSERT(a==IntervalVector(2,Interval(2,3)));
+
+	// different size: the storage is taken
+	IntervalVector c(3,Interval(4,5));
+	const Interval* q=&c[0];
+	a=std::move(c);
+	CPPUNIT_ASSERT(&a[0]==q);
+	CPPUNIT_ASSERT(a==IntervalVector(3,Interval(4,5)));
+
+	a=IntervalVector::empty(3);
+	CPPUNIT_ASSERT(a.is_empty());
+}
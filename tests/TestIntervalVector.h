@@ -172,6 +172,9 @@ public:
 	CPPUNIT_TEST(random01);
 	CPPUNIT_TEST(random02);
 
+	CPPUNIT_TEST(move01);
+	CPPUNIT_TEST(move02);
+
 	CPPUNIT_TEST_SUITE_END();
 
 	/* test:
@@ -415,6 +418,10 @@ public:
 	void random01();
 	void random02();
 
+	// test: IntervalVector(IntervalVector&&), operator=(IntervalVector&&)
+	void move01();
+	void move02();
+
 private:
 	bool test_diff(int n, double x[][2], double y[][2], int m, double z[][2], bool compactness=true, bool debug=false);
 };
@@ -174,6 +174,44 @@ void TestLinearSolver::reset() {
 	check_relatif(vrai,primalsol,1.e-9);
 }
 
+/*
+ * min -sum x_i  s.t.  x_i + sum x_j <= n+1  (i=1..n)
+ *
+ * The optimum x=(1,...,1) is unique and not degenerate
+ * (all the constraints are active, with positive duals).
+ */
+void TestLinearSolver::warm_start() {
+	int n = 6;
+	Matrix A(n, n, 1);
+	for (int i=0; i<n; i++) A[i][i] = 2;
+	Vector b(n, n+1);
+	IntervalVector box(n, Interval(0, 1e3));
+
+	LPSolver lp(n, LPSolver::Mode::Certified);
+	lp.set_bounds(box);
+	lp.set_cost(-Vector::ones(n));
+	lp.add_constraints(A, LEQ, b);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(Vector::ones(n), lp.not_proved_primal_sol(), 1e-9);
+
+	// without a starting basis, more than one pivot is necessary
+	LPSolver lp2(n, LPSolver::Mode::Certified);
+	lp2.set_bounds(box);
+	lp2.set_cost(-Vector::ones(n));
+	lp2.add_constraints(A, LEQ, b);
+	lp2.set_max_iter(1);
+	CPPUNIT_ASSERT(lp2.minimize()==LPSolver::Status::MaxIter);
+
+	// same constraints after a clear (as with a linearization
+	// in a child node): the optimal basis is restored.
+	lp.clear_constraints();
+	lp.add_constraints(A, LEQ, b);
+	lp.set_max_iter(1);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(Vector::ones(n), lp.not_proved_primal_sol(), 1e-9);
+	check_relatif(lp.minimum().lb(), -n, 1e-9);
+}
+
 void TestLinearSolver::test_known_problem(std::string filename, double optimal) {
 	LPSolver lp_ref(filename);
 	LPSolver lp(lp_ref.nb_vars(), LPSolver::Mode::NotCertified);
@@ -198,6 +236,32 @@ void TestLinearSolver::test_known_problem(std::string filename, double optimal)
  *
  * a = 1e-7 is the smallest value where the optimum is found under SoPlex 3.1.1
  */
+/*
+ * The certified minimum must follow the changes of the
+ * constraints and of the bounds between two calls.
+ */
+void TestLinearSolver::certified_after_changes() {
+	LPSolver lp(2, LPSolver::Mode::Certified);
+	lp.set_bounds(IntervalVector(2, Interval(0, 10)));
+	lp.set_cost({-1, -1});
+	lp.add_constraint({1, 1}, LEQ, 4);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(lp.minimum().lb(), -4, 1e-9);
+
+	lp.clear_constraints();
+	lp.add_constraint({1, 2}, LEQ, 2);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(lp.minimum().lb(), -2, 1e-9);
+
+	lp.set_bounds(IntervalVector(2, Interval(0, 0.5)));
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(lp.minimum().lb(), -1, 1e-9);
+
+	lp.clear_constraints();
+	lp.add_constraint({1, 1}, GEQ, 2);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::InfeasibleProved);
+}
+
 void TestLinearSolver::nearly_parallel_constraints() {
 	LPSolver lp(2, LPSolver::Mode::Certified);
 	lp.set_bounds(0, Interval(-1e200, 0));
@@ -225,6 +289,56 @@ void TestLinearSolver::cost_parallel_to_constraint() {
 	check_relatif(obj, -1, 1e-9);
 }
 
+/*
+ * All the constraints are active at the optimum (1,1).
+ */
+void TestLinearSolver::degenerate() {
+	LPSolver lp(2, LPSolver::Mode::Certified);
+	lp.set_bounds(IntervalVector(2, Interval(0, 10)));
+	lp.set_cost({-1, -1});
+	lp.add_constraint({1, 1}, LEQ, 2);
+	lp.add_constraint({1, 0}, LEQ, 1);
+	lp.add_constraint({0, 1}, LEQ, 1);
+	lp.add_constraint({1, 2}, LEQ, 3);
+	lp.add_constraint({2, 1}, LEQ, 3);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(lp.minimum().lb(), -2, 1e-9);
+	check_relatif(Vector::ones(2), lp.not_proved_primal_sol(), 1e-9);
+}
+
+void TestLinearSolver::infeasible() {
+	LPSolver lp(2, LPSolver::Mode::Certified);
+	lp.set_bounds(IntervalVector(2, Interval(0, 10)));
+	lp.set_cost({1, 1});
+	lp.add_constraint({1, 1}, LEQ, 1);
+	lp.add_constraint({1, 1}, GEQ, 3);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::InfeasibleProved);
+}
+
+void TestLinearSolver::unbounded() {
+	LPSolver lp(2, LPSolver::Mode::Certified);
+	lp.set_bounds(IntervalVector(2, Interval(0, 1e200)));
+	lp.set_cost({-1, 0});
+	lp.add_constraint({-1, 1}, LEQ, 1);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::Unbounded);
+}
+
+void TestLinearSolver::time_out() {
+	LPSolver lp(create_kleemin(8));
+	lp.set_timeout(0);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::Timeout);
+}
+
+void TestLinearSolver::max_iter() {
+	LPSolver lp(create_kleemin(8));
+	lp.set_max_iter(1);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::MaxIter);
+	// the search can be resumed
+	lp.set_max_iter(-1);
+	CPPUNIT_ASSERT(lp.minimize()==LPSolver::Status::OptimalProved);
+	check_relatif(lp.minimum().lb(), -1e7, 1e-9);
+}
+
 /*
  * x <= 0
  * y >= 0
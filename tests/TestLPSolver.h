@@ -31,11 +31,18 @@ public:
 	CPPUNIT_TEST(kleemin8);
 	CPPUNIT_TEST(kleemin30);
 	CPPUNIT_TEST(reset);
+	CPPUNIT_TEST(warm_start);
+	CPPUNIT_TEST(certified_after_changes);
 	CPPUNIT_TEST(afiro);
 	CPPUNIT_TEST(adlittle);
 	CPPUNIT_TEST(p25fv47);
 	CPPUNIT_TEST(nearly_parallel_constraints);
 	CPPUNIT_TEST(cost_parallel_to_constraint);
+	CPPUNIT_TEST(degenerate);
+	CPPUNIT_TEST(infeasible);
+	CPPUNIT_TEST(unbounded);
+	CPPUNIT_TEST(time_out);
+	CPPUNIT_TEST(max_iter);
 #endif
 
 	CPPUNIT_TEST_SUITE_END();
@@ -48,9 +55,16 @@ public:
 	void kleemin8() {kleemin(8);};
 	void kleemin30();
 	void reset();
+	void warm_start();
+	void certified_after_changes();
 
 	void nearly_parallel_constraints();
 	void cost_parallel_to_constraint();
+	void degenerate();
+	void infeasible();
+	void unbounded();
+	void time_out();
+	void max_iter();
 	void test_known_problem(std::string filename, double optimal);
 	void afiro() { test_known_problem("../../tests/lp-test-problems/afiro.mps",  -4.6475314286E+02);};
     void adlittle() { test_known_problem("../../tests/lp-test-problems/adlittle.mps", 2.2549496316E+05);};
@@ -157,4 +157,103 @@ void TestNewton::ctc_parameter01() {
 	CPPUNIT_ASSERT(box[0].diam()<=0.1);
 	CPPUNIT_ASSERT(box[1].diam()<=0.1);
 }
+// Broyden tridiagonal function
+static Function* broyden5() {
+	Variable x0,x1,x2,x3,x4;
+	return new Function(x0,x1,x2,x3,x4,Return(
+			(3-2*x0)*x0-2*x1+1,
+			(3-2*x1)*x1-x0-2*x2+1,
+			(3-2*x2)*x2-x1-2*x3+1,
+			(3-2*x3)*x3-x2-2*x4+1,
+			(3-2*x4)*x4-x3+1));
+}
+
+void TestNewton::sparse_newton01() {
+	Function* f=broyden5();
+
+	IntervalVector box(5,Interval(-1,0));
+	IntervalVector box2(box);
+
+	CPPUNIT_ASSERT(newton(*f,box));
+	CPPUNIT_ASSERT(sparse_newton(*f,box2));
+
+	CPPUNIT_ASSERT(box2.max_diam()<1e-10);
+	CPPUNIT_ASSERT(box2.intersects(box));
+	delete f;
+}
+
+void TestNewton::sparse_inflating_newton01() {
+	Function* f=broyden5();
+
+	IntervalVector box(5,Interval(-1,0));
+	sparse_newton(*f,box);
+
+	IntervalVector box_existence(5);
+	IntervalVector box_unicity(5);
+
+	CPPUNIT_ASSERT(sparse_inflating_newton(*f,box.mid(),box_existence,box_unicity));
+	CPPUNIT_ASSERT(box_unicity.is_superset(box_existence));
+	CPPUNIT_ASSERT(box_existence.intersects(box));
+	delete f;
+}
+
+// coupled pairs: x_{2i}+x_{2i+1}=2, x_{2i}-x_{2i+1}=0 (no predominant variable)
+static Function* coupled_pairs6() {
+	Variable x0,x1,x2,x3,x4,x5;
+	return new Function(x0,x1,x2,x3,x4,x5,Return(
+			x0+x1-2, x0-x1,
+			x2+x3-2, x2-x3,
+			x4+x5-2, x4-x5));
+}
+
+void TestNewton::sparse_newton02() {
+	Function* f=coupled_pairs6();
+	Vector sol(6,1.0);
+
+	// without preconditioning, nothing is contracted
+	IntervalVector box(6,Interval(0.9,1.1));
+	sparse_newton(*f,box,default_newton_prec,default_gauss_seidel_ratio,0);
+	CPPUNIT_ASSERT(box==IntervalVector(6,Interval(0.9,1.1)));
+
+	box=IntervalVector(6,Interval(0.9,1.1));
+	CPPUNIT_ASSERT(sparse_newton(*f,box));
+	CPPUNIT_ASSERT(box.contains(sol));
+	CPPUNIT_ASSERT(box.max_diam()<1e-10);
+
+	// blocks of 2 equations
+	box=IntervalVector(6,Interval(0.9,1.1));
+	CPPUNIT_ASSERT(sparse_newton(*f,box,default_newton_prec,default_gauss_seidel_ratio,2));
+	CPPUNIT_ASSERT(box.contains(sol));
+	CPPUNIT_ASSERT(box.max_diam()<1e-10);
+	delete f;
+}
+
+void TestNewton::sparse_inflating_newton02() {
+	Variable x,y;
+	Function f(x,y,Return(x*x+y*y-2,x-y));
+
+	double _x0[][2]={{1.01,1.01},{0.99,0.99}};
+	IntervalVector x0(2,_x0);
+	IntervalVector box_existence(2);
+	IntervalVector box_unicity(2);
+
+	CPPUNIT_ASSERT(sparse_inflating_newton(f,x0,box_existence,box_unicity));
+	CPPUNIT_ASSERT(box_unicity.is_superset(box_existence));
+	CPPUNIT_ASSERT(box_existence.contains(Vector::ones(2)));
+}
+
+void TestNewton::ctc_sparse01() {
+	Variable x,y;
+	Function f(x,y,Return(x+y-2,x-y));
+
+	CtcNewton newton(f,POS_INFINITY);
+	newton.set_sparse(true);
+
+	IntervalVector box(2,Interval(0.9,1.1));
+	newton.contract(box);
+
+	CPPUNIT_ASSERT(box.contains(Vector::ones(2)));
+	CPPUNIT_ASSERT(box.max_diam()<1e-10);
+}
+
 } // end namespace ibex
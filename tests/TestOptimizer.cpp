@@ -116,4 +116,28 @@ void TestOptimizer::unconstrained() {
 	CPPUNIT_ASSERT(o.get_loup()>=0 && o.get_uplo()<=0);
 }
 
+void TestOptimizer::parallel01() {
+
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	System sys(f);
+
+	DefaultOptimizerConfig config(sys);
+	config.set_inHC4(false);
+	config.set_nb_threads(4);
+	config.set_random_seed(2);
+	Optimizer o(config);
+	// the workers are seeded with 2+k
+	CPPUNIT_ASSERT(o.random_seed==2);
+	Optimizer::Status status=o.optimize(IntervalVector(3,Interval(0,10)));
+
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=3 && o.get_uplo()<=3);
+	CPPUNIT_ASSERT(almost_eq(o.get_loup_point(),Vector::ones(3),0.1));
+}
+
 } // end namespace
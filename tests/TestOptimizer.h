@@ -32,6 +32,7 @@ public:
 	CPPUNIT_TEST(issue50_3);
 	CPPUNIT_TEST(issue50_4);
 	CPPUNIT_TEST(unconstrained);
+	CPPUNIT_TEST(parallel01);
 #endif
 	CPPUNIT_TEST_SUITE_END();
 
@@ -50,6 +51,9 @@ public:
 	void issue50_4();
 
 	void unconstrained(); // issue 333 and 335
+
+	// same as vec_problem01 with 4 threads
+	void parallel01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimizer);
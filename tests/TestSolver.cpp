@@ -205,4 +205,75 @@ void TestSolver::circle4() {
 }
 
 
+void TestSolver::parallel01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+
+	double cospi6=0.5;
+	double sinpi6=::sqrt(3)/2;
+	double _sol1[]={cospi6,-sinpi6};
+	double _sol2[]={cospi6,sinpi6};
+
+	Vector sol1(2,_sol1);
+	Vector sol2(2,_sol2);
+	System sys(f);
+
+	DefaultSolver solver(sys,1e-3,DefaultSolver::default_eps_x_max,true,DefaultSolver::default_random_seed,4);
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(status==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()==0);
+	// the order of solutions is not deterministic
+	CPPUNIT_ASSERT(solver.get_data().solution(0).is_superset(sol1) || solver.get_data().solution(1).is_superset(sol1));
+	CPPUNIT_ASSERT(solver.get_data().solution(0).is_superset(sol2) || solver.get_data().solution(1).is_superset(sol2));
+}
+
+void TestSolver::parallel02() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	System sys(f);
+
+	DefaultSolver solver(sys,1e-3,DefaultSolver::default_eps_x_max,true,DefaultSolver::default_random_seed,4);
+	solver.cell_limit=3;
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(status==Solver::CELL_OVERFLOW);
+	// every cell is either processed or pending
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+}
+
+void TestSolver::parallel03() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	// paving the boundary of a disk with boxes of width 1e-9
+	// cannot be achieved within the time limit
+	f.add_ctr(x*x+y*y<=1);
+	System sys(f);
+
+	DefaultSolver solver(sys,1e-9,DefaultSolver::default_eps_x_max,false,DefaultSolver::default_random_seed,4);
+	// the time limit of this solver applies to all the threads
+	solver.time_limit=0.1;
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(status==Solver::TIME_OUT);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+}
+
 } // end namespace
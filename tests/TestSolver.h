@@ -33,6 +33,9 @@ public:
 	CPPUNIT_TEST(circle2);
 	CPPUNIT_TEST(circle3);
 	CPPUNIT_TEST(circle4);
+	CPPUNIT_TEST(parallel01);
+	CPPUNIT_TEST(parallel02);
+	CPPUNIT_TEST(parallel03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void empty();
@@ -40,6 +43,9 @@ public:
 	void circle2();
 	void circle3();
 	void circle4();
+	void parallel01();
+	void parallel02();
+	void parallel03();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);
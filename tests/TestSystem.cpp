@@ -434,4 +434,26 @@ void TestSystem::mutable_cst() {
 	CPPUNIT_ASSERT(solver.get_data().solution(1)[0]==Interval(8));
 	CPPUNIT_ASSERT(solver.get_data().solution(2)[0]==Interval(9));
 }
+
+void TestSystem::goal_ub_batch01() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_goal(sqrt(x)+y);
+	System sys(fac);
+
+	Matrix pts(2,3);
+	pts[0][0]=1; pts[1][0]=2;
+	pts[0][1]=-1; pts[1][1]=0; // outside the definition domain
+	pts[0][2]=4; pts[1][2]=0.1;
+
+	Vector ub(3);
+	sys.goal_ub_batch(pts, ub);
+
+	for (int j=0; j<3; j++)
+		CPPUNIT_ASSERT(ub[j]==sys.goal_ub(pts.col(j)));
+	CPPUNIT_ASSERT(ub[1]==POS_INFINITY);
+}
+
 } // end namespace
@@ -43,6 +43,7 @@ public:
 	CPPUNIT_TEST(merge03);
 	CPPUNIT_TEST(merge04);
 	CPPUNIT_TEST(mutable_cst);
+	CPPUNIT_TEST(goal_ub_batch01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void empty();
@@ -62,6 +63,7 @@ public:
 	void merge03();
 	void merge04();
 	void mutable_cst();
+	void goal_ub_batch01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSystem);